@@ -1,404 +1,967 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-// HTML Checker.cpp : Defines the exported functions for the DLL application.
-
-// Library headers
-#define TIDY_STATIC
-#include "tidy.h"
-#include "tidybuffio.h"
-
-// Windows headers
-#define WIN32_LEAN_AND_MEAN
-#define UNICODE
-#include "targetver.h"
-#include <windows.h>
-
-// Project headers
-#include "HTML Checker.hpp"
-
-// STL headers
-#include <string>
-#include <sstream>
-#include <vector>
-#include <algorithm> // std::remove_if
-
-
-// ----- "public" required functions -----
-
-DLL void Identify(wchar_t* respBuf, const size_t bufSize)
-{
-	if (!checkRespBufSize(respBuf, bufSize)) return;
-	const wchar_t* respStr = L"HTML Checker yaaaaay\0";
-	copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-}
-
-DLL void CheckSyntax(const wchar_t* code, wchar_t* respBuf, const size_t bufSize)
-{
-	if (!checkRespBufSize(respBuf, bufSize)) return;
-
-	// convert from UTF-16 wchar_t to UTF-8 multibyte char
-	const int wc2mb_size_needed = WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), nullptr, 0, nullptr, nullptr);
-	char* mbCodeBuf = new char[wc2mb_size_needed + 1];
-	WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), mbCodeBuf, wc2mb_size_needed, nullptr, nullptr);
-	mbCodeBuf[wc2mb_size_needed] = '\0';
-
-	// Initialize tidy
-	TidyBuffer errorMessageBuffer = {};
-	TidyDoc TD = tidyCreate();
-	const bool err = tidyOptSetValue(TD, TidyCharEncoding, "utf8");
-	if (!err)
-	{
-		const wchar_t * respStr = L"LibTidy Error 1\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-	const int tseb_errorCode = tidySetErrorBuffer(TD, &errorMessageBuffer);
-	if (tseb_errorCode != 0)
-	{
-		const wchar_t * respStr = L"LibTidy Error 2\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-
-	// Check Syntax
-	const int tps_errorCode = tidyParseString(TD, mbCodeBuf);
-	if (tps_errorCode == 0) // no errors or warnings
-	{
-		const wchar_t * respStr = L"SUCCESS\0";
-		const size_t respStrLen = wcslen(respStr);
-		copyToRespBuf(respBuf, bufSize, respStr, respStrLen);
-		delete[] mbCodeBuf;
-		if(errorMessageBuffer.bp) tidyBufFree(&errorMessageBuffer);
-		tidyRelease(TD);
-		return;
-	}
-	else // there are errors and/or warnings
-	{
-		// convert back from UTF-8 multibyte char to UTF-16 wchar_t
-		const int mb2wc_size_needed = MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<char*>(errorMessageBuffer.bp), static_cast<int>(errorMessageBuffer.size), nullptr, 0);
-		wchar_t * wErrMsgBuf = new wchar_t[mb2wc_size_needed];
-		MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<char*>(errorMessageBuffer.bp), static_cast<int>(errorMessageBuffer.size), wErrMsgBuf, mb2wc_size_needed);
-
-		// clean up memory and return
-		copyToRespBuf(respBuf, bufSize, wErrMsgBuf, mb2wc_size_needed);
-		delete[] wErrMsgBuf;
-		delete[] mbCodeBuf;
-		if(errorMessageBuffer.bp) tidyBufFree(&errorMessageBuffer);
-		tidyRelease(TD);
-		return;
-	}
-}
-
-DLL void Query(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize)
-{
-	if (!checkRespBufSize(respBuf, bufSize)) return;
-	if (wcscmp(command, L"StyleCheck") == 0) CheckStyle(code, respBuf, bufSize);
-	else if (wcsstr(command, L"contains") == command) Contains(code, command, respBuf, bufSize);
-}
-
-// ----- obscured functions -----
-DLL void CheckStyle(const wchar_t* code, wchar_t* respBuf, const size_t bufSize)
-{
-	if (!checkRespBufSize(respBuf, bufSize)) return;
-	
-	// convert from UTF-16 wchar_t to UTF-8 multibyte char
-	const int wc2mb_size_needed = WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), nullptr, 0, nullptr, nullptr);
-	char* mbCodeBuf = new char[wc2mb_size_needed + 1];
-	WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), mbCodeBuf, wc2mb_size_needed, nullptr, nullptr);
-	mbCodeBuf[wc2mb_size_needed] = '\0';
-
-	// Initialize tidy
-	TidyBuffer errorMessageBuffer = {};
-	TidyBuffer outputBuffer = {};
-	TidyDoc TD = tidyCreate();
-	const bool err = tidyOptSetValue(TD, TidyCharEncoding, "utf8");
-	const bool err2 = tidyOptSetInt(TD, TidyIndentContent, TidyTriState::TidyAutoState);
-	const bool err3 = tidyOptSetBool(TD, TidyForceOutput, Bool::yes);
-	const bool err4 = tidyOptSetBool(TD, TidyDropEmptyElems, Bool::no);
-	const bool err5 = tidyOptSetBool(TD, TidyDropEmptyParas, Bool::no);
-	//const bool err6 = tidyOptSetInt(TD, TidyVertSpace, TidyTriState::TidyAutoState);
-	if (!err || !err2 || !err3 || !err4 || !err5)
-	{
-		const wchar_t * respStr = L"LibTidy Error 1\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-	const int tseb_errorCode = tidySetErrorBuffer(TD, &errorMessageBuffer);
-	if (tseb_errorCode != 0)
-	{
-		const wchar_t * respStr = L"LibTidy Error 2\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-
-	// Load Code
-	const int tps_errorCode = tidyParseString(TD, mbCodeBuf);
-	if(tps_errorCode != 0) // Welp, can't process style with syntax errors
-	{
-		const wchar_t * respStr = L"Error:  cannot check style if there are syntax errors!\0";
-		const size_t respStrLen = wcslen(respStr);
-		copyToRespBuf(respBuf, bufSize, respStr, respStrLen);
-		delete[] mbCodeBuf;
-		if (errorMessageBuffer.bp) tidyBufFree(&errorMessageBuffer);
-		tidyRelease(TD);
-		return;
-	}
-
-	// Check formatting
-	const int tsb_errorCode = tidySaveBuffer(TD, &outputBuffer);
-	char* outBuf = new char[outputBuffer.size + 1];
-	strncpy(outBuf, reinterpret_cast<const char*>(outputBuffer.bp), outputBuffer.size);
-	if (outBuf[outputBuffer.size - 2] == '\r') // remove trailing newline
-	{
-		outBuf[outputBuffer.size - 2] = '\0';
-		outBuf[outputBuffer.size - 1] = '\0';
-	}
-	if (tsb_errorCode == 0)
-	{
-		if (strcmp(mbCodeBuf, outBuf) == 0)
-		{
-			const wchar_t * respStr = L"SUCCESS\0";
-			const size_t respStrLen = wcslen(respStr);
-			copyToRespBuf(respBuf, bufSize, respStr, respStrLen);
-		}
-		else
-		{
-			const wchar_t * respStr = L"Style Error: remember to indent and put new tags on new lines!\0";
-			const size_t respStrLen = wcslen(respStr);
-			copyToRespBuf(respBuf, bufSize, respStr, respStrLen);
-		}
-	}
-	else
-	{
-		const wchar_t * respStr = L"LibTidy Error 3\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-	}
-	delete[] mbCodeBuf;
-	if (errorMessageBuffer.bp) tidyBufFree(&errorMessageBuffer);
-	if (outputBuffer.bp) tidyBufFree(&outputBuffer);
-	tidyRelease(TD);
-	return;
-}
-
-DLL void Contains(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize)
-{
-	// Step 0: convert command from UTF-16 wchar_t to UTF-8 multibyte char
-	const int wc2mb_size_needed_cmd = WideCharToMultiByte(CP_UTF8, 0, command, static_cast<int>(wcslen(command)), nullptr, 0, nullptr, nullptr);
-	std::string mbCmdStr(wc2mb_size_needed_cmd, 0);
-	WideCharToMultiByte(CP_UTF8, 0, command, static_cast<int>(wcslen(command)), &mbCmdStr[0], wc2mb_size_needed_cmd, nullptr, nullptr);
-
-	// First thing on the agenda is parsing the command.  The parameter defines tags, nesting, and attributes.  All that info needs to be extracted
-	std::string paramsStr = mbCmdStr.substr(8); // exclude the command name (contains) so we only have to parse the parameter
-	paramsStr.erase(std::remove_if(paramsStr.begin(), paramsStr.end(), isspace), paramsStr.end()); // remove whitespace
-	std::vector <Elem> elems = {};
-	const char withinDelim = '>';
-	size_t offset = paramsStr.length();
-	while (offset != std::string::npos) // back-to-front extract elems (right-most elem is lowest-level nesting)
-	{
-		const size_t withinFoundPos = paramsStr.rfind(withinDelim, offset);
-		std::string elemAndAttr = "";
-		if (withinFoundPos == std::string::npos) elemAndAttr = paramsStr.substr(0, offset + 1);
-		else elemAndAttr = paramsStr.substr(withinFoundPos + 1, offset - withinFoundPos);
-		const size_t openParenFoundPos = elemAndAttr.find('(');
-		const size_t closeParenFoundPos = elemAndAttr.find(')');
-		if ((openParenFoundPos == std::string::npos) || (closeParenFoundPos == std::string::npos)) break;
-		Elem elem = {};
-		elem.name = elemAndAttr.substr(0, openParenFoundPos);
-		if (closeParenFoundPos - openParenFoundPos != 1) // extract the attribute data
-		{
-			const std::string attributes = elemAndAttr.substr(openParenFoundPos + 1, closeParenFoundPos - openParenFoundPos - 1);
-			std::istringstream stream(attributes);
-			std::string attrKVPair = "";
-			while (std::getline(stream, attrKVPair, '|'))
-			{
-				const size_t equalsFoundPos = attrKVPair.find('=');
-				if (equalsFoundPos == std::string::npos) break;
-				const std::string key = attrKVPair.substr(0, equalsFoundPos);
-				const size_t firstQuotePos = attrKVPair.find('\"');
-				const size_t lastQuotePos = attrKVPair.rfind('\"');
-				if ((firstQuotePos == std::string::npos) || (lastQuotePos == std::string::npos) || (firstQuotePos == lastQuotePos)) break;
-				const std::string value = attrKVPair.substr(firstQuotePos + 1, lastQuotePos - firstQuotePos - 1);
-				elem.attributes.emplace(key, value);
-			}
-			if (elem.attributes.empty()) break;
-		}
-		elems.push_back(elem);
-		if(withinFoundPos != std::string::npos) offset = withinFoundPos - 1;
-		else break;
-	}
-
-	// Alright, time to process the code and check for our contains statement
-	if (!checkRespBufSize(respBuf, bufSize)) return;
-
-	// convert code from UTF-16 wchar_t to UTF-8 multibyte char
-	const int wc2mb_size_needed = WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), nullptr, 0, nullptr, nullptr);
-	char* mbCodeBuf = new char[wc2mb_size_needed + 1];
-	WideCharToMultiByte(CP_UTF8, 0, code, static_cast<int>(wcslen(code)), mbCodeBuf, wc2mb_size_needed, nullptr, nullptr);
-	mbCodeBuf[wc2mb_size_needed] = '\0';
-
-	// Initialize tidy
-	TidyBuffer errorMessageBuffer = {};
-	TidyBuffer outputBuffer = {};
-	TidyDoc TD = tidyCreate();
-	const bool err = tidyOptSetValue(TD, TidyCharEncoding, "utf8");
-	if (!err)
-	{
-		const wchar_t * respStr = L"LibTidy Error 1\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-	const int tseb_errorCode = tidySetErrorBuffer(TD, &errorMessageBuffer);
-	if (tseb_errorCode != 0)
-	{
-		const wchar_t * respStr = L"LibTidy Error 2\0";
-		copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
-		delete[] mbCodeBuf;
-		tidyRelease(TD);
-		return;
-	}
-
-	// Load Code
-	const int tps_errorCode = tidyParseString(TD, mbCodeBuf);
-	if (tps_errorCode != 0) // Welp, can't process style with syntax errors
-	{
-		const wchar_t * respStr = L"Error:  cannot check style if there are syntax errors!\0";
-		const size_t respStrLen = wcslen(respStr);
-		copyToRespBuf(respBuf, bufSize, respStr, respStrLen);
-		delete[] mbCodeBuf;
-		if (errorMessageBuffer.bp) tidyBufFree(&errorMessageBuffer);
-		tidyRelease(TD);
-		return;
-	}
-
-	// Check against code
-	TidyNode curNode = {};
-	if (elems[0].name == "head")
-	{
-		curNode = tidyGetHead(TD);
-	}
-	else
-	{
-		curNode = tidyGetBody(TD);
-	}
-	int numSuccess = 1;
-	for (int i = 1; i < elems.size(); i++)
-	{
-		// find the element type
-		TidyNode lastChildNode = {};
-		TidyNode curChildNode = tidyGetChild(curNode);
-		while (curChildNode && (curChildNode != lastChildNode) )
-		{
-			const std::string name = tidyNodeGetName(curChildNode);
-			if (name == elems[i].name)
-			{
-				if (elemContainsExactAttributes(elems[i], curChildNode))
-				{
-					numSuccess++;
-					curNode = curChildNode;
-					break;
-				}
-				else
-				{
-					lastChildNode = curChildNode;
-					curChildNode = tidyGetNext(curChildNode);
-				}
-			}
-			else
-			{
-				lastChildNode = curChildNode;
-				curChildNode = tidyGetNext(curChildNode);
-			}
-		}
-	}
-	if (numSuccess == elems.size())
-	{
-		const wchar_t * respStr = L"SUCCESS";
-		copyToRespBuf(respBuf, respBufSize, respStr, wcslen(respStr));
-	}
-	else
-	{
-		const int mb2wc_size_needed = MultiByteToWideChar(CP_UTF8, 0, &elems[numSuccess].name[0], static_cast<int>(elems[numSuccess].name.length()), nullptr, 0);
-		std::wstring name(mb2wc_size_needed, 0);
-		MultiByteToWideChar(CP_UTF8, 0, &elems[numSuccess].name[0], static_cast<int>(elems[numSuccess].name.length()), &name[0], mb2wc_size_needed);
-		std::wstring respStr = L"The required \'" + name + L"\' element is missing or incorrect";
-		copyToRespBuf(respBuf, respBufSize, respStr.c_str(), respStr.length());
-	}
-}
-
-// ----- helper functions -----
-
-DLL bool checkRespBufSize(wchar_t* respBuf, const size_t bufSize)
-{
-	if (bufSize < 2)  // forbidden; at least 2 chars needed for error reporting
-	{
-		if (bufSize == 1) respBuf[0] = L'0';
-		return false;
-	}
-	else return true;
-}
-
-DLL void copyToRespBuf(wchar_t* respBuf, const size_t respBufSize, const wchar_t* sourceBuf, const size_t sourceBufSize)
-{
-	try
-	{
-		const size_t charsToCopy = (respBufSize < sourceBufSize) ? respBufSize : sourceBufSize;
-		wcsncpy(respBuf, sourceBuf, respBufSize);
-		//const errno_t err = wcsncpy_s(respBuf, respBufSize, sourceBuf, sourceBufSize);
-		//if ( (err != 0) && (respBuf[0] == L'\0') ) respBuf[1] = static_cast<wchar_t>(err);
-	}
-	catch (...){}
-}
-
-DLL bool elemContainsExactAttributes(const Elem& elem, TidyNode& childNode)
-{
-	int numSuccess = 0;
-	for (auto const & attrPair : elem.attributes)
-	{
-		TidyAttr lastAttr = {};
-		TidyAttr curAttr = tidyAttrFirst(childNode);
-		while (curAttr && (curAttr != lastAttr) )
-		{
-			const std::string attrName = tidyAttrName(curAttr);
-			const std::string attrValue = tidyAttrValue(curAttr);
-			if ( (attrName == attrPair.first) && (attrValue == attrPair.second))
-			{
-				numSuccess++;
-				break;
-			}
-			else
-			{
-				lastAttr = curAttr;
-				curAttr = tidyAttrNext(curAttr);
-			}
-		}
-	}
-	return numSuccess == elem.attributes.size();
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// HTML Checker.cpp : Defines the exported functions for the DLL application.
+
+// Library headers
+#define TIDY_STATIC
+#include "tidy.h"
+#include "tidybuffio.h"
+
+// Windows headers
+#define WIN32_LEAN_AND_MEAN
+#define UNICODE
+#include "targetver.h"
+#include <windows.h>
+
+// Project headers
+#include "HTML Checker.hpp"
+
+// STL headers
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm> // std::remove_if, std::count, std::binary_search
+#include <cstring> // std::strcmp, std::strlen
+#include <cctype> // std::tolower, std::isalpha
+#include <new> // std::nothrow
+#include <cerrno> // ENOMEM
+#include <memory> // std::shared_ptr
+#include <mutex>
+#include <unordered_map>
+
+
+// ----- tidy documents -----
+
+enum class TidyProfile : size_t
+{
+	SYNTAX = 0, // the default options, for CheckSyntax and the contains queries
+	STYLE = 1, // empty elements kept, for the style check of code whose syntax check warned
+};
+
+struct TidyContext // a TidyDoc set up with the options of its profile, its own error buffer, and the pool it goes back to
+{
+	TidyDoc TD = nullptr;
+	TidyBuffer errorMessageBuffer = {};
+	TidyProfile profile = TidyProfile::SYNTAX;
+	const char* setupError = nullptr; // set if tidy couldn't be initialized
+};
+
+namespace
+{
+	const size_t MaxCachedSelectors = 4096;
+	const size_t MaxIdleTidyDocs = 8; // per profile; more than the checks running at once only holds on to memory
+
+	class TidyPool // idle TidyDocs by profile, each set up once and handed out again by every thread's checks
+	{
+		private:
+			std::mutex mutex{};
+			std::vector<TidyContext*> idle[2]{}; // by TidyProfile
+			static TidyContext* create(const TidyProfile profile);
+			static void destroy(TidyContext* context) noexcept;
+		public:
+			TidyPool() = default;
+			TidyPool(const TidyPool&) = delete;
+			TidyPool& operator=(const TidyPool&) = delete;
+			~TidyPool();
+			TidyContext* Acquire(const TidyProfile profile); // throws std::bad_alloc
+			void Release(TidyContext* context) noexcept;
+	};
+
+	TidyContext* TidyPool::create(const TidyProfile profile)
+	{
+		TidyContext* context = new TidyContext();
+		context->profile = profile;
+		context->TD = tidyCreate();
+		bool err = tidyOptSetValue(context->TD, TidyCharEncoding, "utf8");
+		if (profile == TidyProfile::STYLE)
+		{
+			const bool err2 = tidyOptSetBool(context->TD, TidyDropEmptyElems, Bool::no);
+			const bool err3 = tidyOptSetBool(context->TD, TidyDropEmptyParas, Bool::no);
+			err = err && err2 && err3;
+		}
+		if (!err) context->setupError = "LibTidy Error 1";
+		else if (tidySetErrorBuffer(context->TD, &context->errorMessageBuffer) != 0) context->setupError = "LibTidy Error 2";
+		else tidyOptSnapshot(context->TD); // what Release puts the options back to, if a parse adjusted them
+		return context;
+	}
+
+	void TidyPool::destroy(TidyContext* context) noexcept
+	{
+		if (context->errorMessageBuffer.bp) tidyBufFree(&context->errorMessageBuffer);
+		tidyRelease(context->TD);
+		delete context;
+	}
+
+	TidyPool::~TidyPool()
+	{
+		for (std::vector<TidyContext*>& contexts : this->idle)
+		{
+			for (TidyContext* context : contexts) destroy(context);
+		}
+	}
+
+	TidyContext* TidyPool::Acquire(const TidyProfile profile)
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			std::vector<TidyContext*>& contexts = this->idle[static_cast<size_t>(profile)];
+			if (!contexts.empty())
+			{
+				TidyContext* context = contexts.back();
+				contexts.pop_back();
+				return context;
+			}
+		}
+		return create(profile); // outside the lock; the other threads' checks don't wait on a tidyCreate
+	}
+
+	void TidyPool::Release(TidyContext* context) noexcept
+	{
+		// tidy has no call to reset a document's error and warning counts, and tidyParseString's result is worked out
+		// from them, so only a document whose last parse left them at 0 can be parsed into again and report only its own
+		if (!context) return;
+		const bool clean = !context->setupError && tidyErrorCount(context->TD) == 0 && tidyWarningCount(context->TD) == 0 && tidyAccessWarningCount(context->TD) == 0;
+		if (clean)
+		{
+			tidyBufClear(&context->errorMessageBuffer);
+			if (tidyOptDiffThanSnapshot(context->TD)) tidyOptResetToSnapshot(context->TD);
+			try
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				std::vector<TidyContext*>& contexts = this->idle[static_cast<size_t>(context->profile)];
+				if (contexts.size() < MaxIdleTidyDocs)
+				{
+					contexts.push_back(context);
+					return;
+				}
+			}
+			catch (...) {} // out of memory for the list: just release it
+		}
+		destroy(context);
+	}
+
+	TidyPool TidyDocs; // for as long as the DLL is loaded
+
+	struct TidyContextReleaser
+	{
+		void operator()(TidyContext* context) const noexcept
+		{
+			TidyDocs.Release(context);
+		}
+	};
+}
+
+// ----- the parsed code -----
+
+struct IndexedNode
+{
+	std::unordered_multimap<std::string, std::string> attributes{}; // (attr_name,attr_val)
+	std::unordered_map<std::string, std::vector<TidyNode>> children{}; // the element children by name, in document order
+};
+
+struct DocumentIndex // the session's document, indexed once for all of its contains queries
+{
+	TidyNode head = nullptr;
+	TidyNode body = nullptr;
+	std::unordered_map<TidyNode, IndexedNode> nodes{};
+};
+
+struct CheckerSession
+{
+	std::string mbCode = ""; // the code as UTF-8
+	TidyContext* syntax = nullptr; // parsed with TidyProfile::SYNTAX, held until the session is closed
+	int parseResult = 0; // tidyParseString's result: 0 for no errors or warnings
+	std::unique_ptr<DocumentIndex> index{}; // built by the first contains query
+	bool styleChecked = false; // the style check needs a parse with its own options, so its answer is kept
+	std::string styleResponse = "";
+	std::vector<std::string> runAllQueries{}; // SessionRunAllUTF8's last results, so a call with a bigger buffer only copies them
+	std::vector<CheckerResult> runAllRecords{};
+	std::string runAllText = "";
+	std::vector<std::wstring> runAllWideQueries{}; // the same for SessionRunAll, converted to UTF-16
+	std::vector<CheckerResult> runAllWideRecords{};
+	std::wstring runAllWideText = L"";
+};
+
+namespace
+{
+	std::string toUTF8(const wchar_t* text, const size_t length) // convert from UTF-16 wchar_t to UTF-8 multibyte char
+	{
+		const int wc2mb_size_needed = WideCharToMultiByte(CP_UTF8, 0, text, static_cast<int>(length), nullptr, 0, nullptr, nullptr);
+		std::string mbText(wc2mb_size_needed, '\0');
+		if (wc2mb_size_needed > 0) WideCharToMultiByte(CP_UTF8, 0, text, static_cast<int>(length), &mbText[0], wc2mb_size_needed, nullptr, nullptr);
+		return mbText;
+	}
+
+	std::wstring fromUTF8(const char* text, const size_t length) // convert back from UTF-8 multibyte char to UTF-16 wchar_t
+	{
+		const int mb2wc_size_needed = MultiByteToWideChar(CP_UTF8, 0, text, static_cast<int>(length), nullptr, 0);
+		std::wstring wText(mb2wc_size_needed, L'\0');
+		if (mb2wc_size_needed > 0) MultiByteToWideChar(CP_UTF8, 0, text, static_cast<int>(length), &wText[0], mb2wc_size_needed);
+		return wText;
+	}
+
+	void respond(wchar_t* respBuf, const size_t bufSize, const std::string& response) // the checks all answer in UTF-8; only the UTF-16 exports convert
+	{
+		const std::wstring wResponse = fromUTF8(response.data(), response.length());
+		copyToRespBuf(respBuf, bufSize, wResponse.c_str(), wResponse.length());
+	}
+
+	void respondNoSession(wchar_t* respBuf) // the caller's buffer already passed checkRespBufSize
+	{
+		respBuf[0] = L'\0';
+		respBuf[1] = static_cast<wchar_t>(ENOMEM);
+	}
+
+	// The style the lessons teach is the layout tidy prints with indent-content set to auto: a block element starts a
+	// line, indented two spaces inside its parent (html's children excepted), p, headings and title keep their content
+	// on their own line, and inline elements and text flow within it.  Rather than printing tidy's copy and comparing,
+	// the parsed tree is walked alongside the code, and the first place they part ways is reported.
+
+	const char* const InlineElements[] = { "a", "abbr", "acronym", "applet", "audio", "b", "basefont", "bdi", "bdo", "big", "blink", "br", "button", "canvas", "cite", "code", "data", "del", "dfn", "em", "embed", "font", "i", "iframe", "img", "input", "ins", "kbd", "label", "map", "mark", "meter", "nobr", "noscript", "object", "output", "progress", "q", "rb", "rbc", "rp", "rt", "rtc", "ruby", "s", "samp", "select", "small", "spacer", "span", "strike", "strong", "sub", "sup", "textarea", "time", "tt", "u", "var", "video", "wbr" }; // sorted
+	const char* const VoidElements[] = { "area", "base", "basefont", "br", "col", "embed", "frame", "hr", "img", "input", "isindex", "keygen", "link", "meta", "param", "source", "track", "wbr" }; // sorted; no end tag
+	const char* const RawTextElements[] = { "listing", "plaintext", "pre", "script", "style", "textarea", "xmp" }; // sorted; printed as written
+	const char* const NoIndentElements[] = { "dd", "dt", "li", "td", "th" }; // sorted; content indented only if it holds a block element
+	const char* const OneLineElements[] = { "h1", "h2", "h3", "h4", "h5", "h6", "p", "title" }; // sorted; content never indented
+
+	bool isSpace(const char c) noexcept
+	{
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f';
+	}
+
+	template <size_t N>
+	bool isOneOf(const char* name, const char* const (&names)[N])
+	{
+		return std::binary_search(names, names + N, name, [](const char* a, const char* b) { return std::strcmp(a, b) < 0; });
+	}
+
+	enum class StyleLayout : unsigned char
+	{
+		ROOT, // the document: its first node opens the code, and the rest start lines of their own
+		LINES, // an indented element's content, and html's: block children and the end tag start lines
+		ONE_LINE, // p, headings, title, and elements without block content: the content and end tag share the start tag's line
+		FREE, // inline elements: tidy wraps text where it likes, so only the tags are matched
+	};
+
+	struct StyleFrame // an element whose children are being checked
+	{
+		TidyNode node = nullptr; // nullptr for the document
+		const char* name = "";
+		TidyNode next = nullptr; // the next child to check
+		StyleLayout layout = StyleLayout::ROOT;
+		size_t indent = 0; // of the element's own tags
+		size_t contentIndent = 0; // of its block children
+		bool first = true; // next is the first child
+		bool textOnStartLine = false; // an indented li that starts with text keeps that text on the start tag's line
+	};
+
+	class StyleValidator // walks tidy's tree and the code together, once, up to the first violation
+	{
+		private:
+			const std::string& code;
+			size_t pos = 0; // the end of the code matched so far
+			size_t violation = std::string::npos;
+			size_t nextToken(void) const noexcept;
+			bool fail(const size_t at) noexcept;
+			bool startsLine(const size_t tokenPos, const size_t indent) noexcept;
+			bool onLine(const size_t tokenPos) noexcept;
+			bool matchName(size_t at, const char* name) const noexcept;
+			bool matchStartTag(const size_t tokenPos, const char* name) noexcept;
+			bool matchEndTag(const char* name) noexcept;
+			bool matchUntil(const size_t tokenPos, const char* open, const char* close) noexcept;
+			bool matchText(const size_t tokenPos) noexcept;
+			bool matchRawText(const char* name) noexcept;
+			bool checkGap(const StyleFrame& frame, const bool block, const bool first) noexcept;
+			StyleFrame openElement(const StyleFrame& parent, const TidyNode node, const char* name) const noexcept;
+		public:
+			explicit StyleValidator(const std::string& _code) noexcept;
+			size_t Check(TidyDoc TD); // the offset of the first violation, or std::string::npos
+	};
+
+	StyleValidator::StyleValidator(const std::string& _code) noexcept : code(_code) {}
+
+	size_t StyleValidator::nextToken() const noexcept
+	{
+		size_t tokenPos = this->pos;
+		while (tokenPos < this->code.size() && isSpace(this->code[tokenPos])) tokenPos++;
+		return tokenPos;
+	}
+
+	bool StyleValidator::fail(const size_t at) noexcept
+	{
+		this->violation = at;
+		return false;
+	}
+
+	bool StyleValidator::startsLine(const size_t tokenPos, const size_t indent) noexcept // one line break, then exactly indent spaces
+	{
+		size_t gapPos = this->pos;
+		if (gapPos < tokenPos && this->code[gapPos] == '\r') gapPos++;
+		if (gapPos >= tokenPos || this->code[gapPos] != '\n') return this->fail(tokenPos); // no line break, or spaces left at the end of the line
+		gapPos++;
+		if (tokenPos - gapPos != indent) return this->fail(tokenPos);
+		for (; gapPos < tokenPos; gapPos++)
+		{
+			if (this->code[gapPos] != ' ') return this->fail(tokenPos); // a tab, or a blank line
+		}
+		return true;
+	}
+
+	bool StyleValidator::onLine(const size_t tokenPos) noexcept
+	{
+		for (size_t gapPos = this->pos; gapPos < tokenPos; gapPos++)
+		{
+			if (this->code[gapPos] == '\r' || this->code[gapPos] == '\n') return this->fail(tokenPos);
+		}
+		return true;
+	}
+
+	bool StyleValidator::matchName(size_t at, const char* name) const noexcept // tidy gives names in lowercase
+	{
+		for (; *name; name++, at++)
+		{
+			if (at >= this->code.size() || std::tolower(static_cast<unsigned char>(this->code[at])) != *name) return false;
+		}
+		return at < this->code.size() && (isSpace(this->code[at]) || this->code[at] == '/' || this->code[at] == '>');
+	}
+
+	bool StyleValidator::matchStartTag(const size_t tokenPos, const char* name) noexcept
+	{
+		if (tokenPos >= this->code.size() || this->code[tokenPos] != '<' || !this->matchName(tokenPos + 1, name)) return this->fail(tokenPos); // tidy added or moved an element
+		char quote = '\0';
+		for (size_t tagPos = tokenPos + 1 + std::strlen(name); tagPos < this->code.size(); tagPos++)
+		{
+			const char c = this->code[tagPos];
+			if (quote) quote = (c == quote) ? '\0' : quote;
+			else if (c == '\"' || c == '\'') quote = c;
+			else if (c == '>')
+			{
+				this->pos = tagPos + 1;
+				return true;
+			}
+		}
+		return this->fail(tokenPos);
+	}
+
+	bool StyleValidator::matchEndTag(const char* name) noexcept // tidy prints every end tag, even those HTML lets the code leave out
+	{
+		const size_t tokenPos = this->nextToken();
+		if (this->code.compare(tokenPos, 2, "</") != 0 || !this->matchName(tokenPos + 2, name)) return this->fail(tokenPos);
+		const size_t closePos = this->code.find('>', tokenPos);
+		if (closePos == std::string::npos) return this->fail(tokenPos);
+		this->pos = closePos + 1;
+		return true;
+	}
+
+	bool StyleValidator::matchUntil(const size_t tokenPos, const char* open, const char* close) noexcept // comments, the doctype and the like
+	{
+		if (this->code.compare(tokenPos, std::strlen(open), open) != 0) return this->fail(tokenPos);
+		const size_t closePos = this->code.find(close, tokenPos + std::strlen(open));
+		if (closePos == std::string::npos) return this->fail(tokenPos);
+		this->pos = closePos + std::strlen(close);
+		return true;
+	}
+
+	bool StyleValidator::matchText(const size_t tokenPos) noexcept // up to the next tag, leaving the whitespace before it to the layout; false if there's none
+	{
+		size_t textEnd = tokenPos;
+		for (; textEnd + 1 < this->code.size(); textEnd++)
+		{
+			const char next = this->code[textEnd + 1];
+			if (this->code[textEnd] == '<' && (std::isalpha(static_cast<unsigned char>(next)) || next == '/' || next == '!' || next == '?')) break;
+		}
+		if (textEnd + 1 == this->code.size()) textEnd++;
+		while (textEnd > tokenPos && isSpace(this->code[textEnd - 1])) textEnd--;
+		if (textEnd == tokenPos) return false; // only whitespace, which tidy kept between inline elements
+		this->pos = textEnd;
+		return true;
+	}
+
+	bool StyleValidator::matchRawText(const char* name) noexcept // script, style, pre and friends: whatever is up to the end tag
+	{
+		for (size_t closePos = this->code.find("</", this->pos); closePos != std::string::npos; closePos = this->code.find("</", closePos + 2))
+		{
+			if (!this->matchName(closePos + 2, name)) continue;
+			this->pos = closePos;
+			return this->matchEndTag(name);
+		}
+		return this->fail(this->pos);
+	}
+
+	bool StyleValidator::checkGap(const StyleFrame& frame, const bool block, const bool first) noexcept // the whitespace before a child
+	{
+		const size_t tokenPos = this->nextToken();
+		switch (frame.layout)
+		{
+			case StyleLayout::ROOT:
+				if (first) return (tokenPos == 0) || this->fail(tokenPos);
+				return this->startsLine(tokenPos, 0);
+			case StyleLayout::LINES:
+				if (first && !block && frame.textOnStartLine) return this->onLine(tokenPos);
+				if (block || first) return this->startsLine(tokenPos, frame.contentIndent);
+				return true; // text and inline elements after the first flow on, wrapped wherever tidy likes
+			case StyleLayout::ONE_LINE:
+				if (block) return this->startsLine(tokenPos, frame.contentIndent);
+				if (first) return this->onLine(tokenPos);
+				return true;
+			default:
+				return true;
+		}
+	}
+
+	StyleFrame StyleValidator::openElement(const StyleFrame& parent, const TidyNode node, const char* name) const noexcept // how tidy would lay the element's content out
+	{
+		StyleFrame frame{ node, name, tidyGetChild(node), StyleLayout::ONE_LINE, parent.contentIndent, parent.contentIndent, true, false };
+		if (parent.layout == StyleLayout::FREE || isOneOf(name, InlineElements))
+		{
+			frame.layout = StyleLayout::FREE;
+			return frame;
+		}
+		if (std::strcmp(name, "html") == 0 || (!frame.next && (std::strcmp(name, "head") == 0 || std::strcmp(name, "body") == 0)))
+		{
+			frame.layout = StyleLayout::LINES; // children on lines of their own, but not indented
+			return frame;
+		}
+		if (!frame.next || isOneOf(name, OneLineElements)) return frame;
+		TidyNode last = frame.next;
+		bool blockContent = false;
+		for (TidyNode child = frame.next; child; child = tidyGetNext(child))
+		{
+			const char* childName = tidyNodeGetName(child);
+			if (childName && tidyNodeGetType(child) != TidyNode_Text && !isOneOf(childName, InlineElements)) blockContent = true;
+			last = child;
+		}
+		if (isOneOf(name, NoIndentElements) && !blockContent) return frame;
+		const char* lastName = tidyNodeGetName(last);
+		if (std::strcmp(name, "div") == 0 && lastName && std::strcmp(lastName, "img") == 0) return frame; // tidy's workaround for an old IE bug
+		frame.layout = StyleLayout::LINES;
+		frame.contentIndent = frame.indent + 2;
+		frame.textOnStartLine = (std::strcmp(name, "li") == 0) && (tidyNodeGetType(frame.next) == TidyNode_Text);
+		return frame;
+	}
+
+	size_t StyleValidator::Check(TidyDoc TD)
+	{
+		std::vector<StyleFrame> open{ StyleFrame{ nullptr, "", tidyGetChild(tidyGetRoot(TD)) } }; // a stack, so deeply nested pages can't overflow the real one
+		while (!open.empty())
+		{
+			if (!open.back().next) // the children are done: the end tag
+			{
+				const StyleFrame frame = open.back();
+				open.pop_back();
+				if (!frame.node) break;
+				const size_t tokenPos = this->nextToken();
+				if (frame.layout == StyleLayout::LINES && !this->startsLine(tokenPos, frame.indent)) return this->violation;
+				if (frame.layout == StyleLayout::ONE_LINE && !this->onLine(tokenPos)) return this->violation;
+				if (!this->matchEndTag(frame.name)) return this->violation;
+				continue;
+			}
+			StyleFrame& parent = open.back();
+			const TidyNode node = parent.next;
+			const bool first = parent.first;
+			parent.next = tidyGetNext(node);
+			parent.first = false;
+			const TidyNodeType type = tidyNodeGetType(node);
+			if (type == TidyNode_Text)
+			{
+				const size_t gapEnd = this->pos;
+				if (!this->matchText(this->nextToken())) continue;
+				const size_t textEnd = this->pos;
+				this->pos = gapEnd;
+				if (!this->checkGap(parent, false, first)) return this->violation;
+				this->pos = textEnd;
+			}
+			else if (type == TidyNode_Start || type == TidyNode_StartEnd)
+			{
+				const char* name = tidyNodeGetName(node);
+				const bool block = name && !isOneOf(name, InlineElements) && std::strcmp(name, "script") != 0 && std::strcmp(name, "style") != 0;
+				if (!this->checkGap(parent, block, first)) return this->violation;
+				if (!name)
+				{
+					this->fail(this->nextToken());
+					return this->violation;
+				}
+				const bool raw = isOneOf(name, RawTextElements);
+				if (!this->matchStartTag(this->nextToken(), name)) return this->violation;
+				if (raw)
+				{
+					if (!this->matchRawText(name)) return this->violation;
+				}
+				else if (!isOneOf(name, VoidElements)) open.push_back(this->openElement(open.back(), node, name));
+			}
+			else
+			{
+				const bool block = (type == TidyNode_DocType || type == TidyNode_Comment) && (parent.layout == StyleLayout::ROOT || parent.layout == StyleLayout::LINES);
+				if (!this->checkGap(parent, block, first)) return this->violation;
+				const size_t tokenPos = this->nextToken();
+				bool matched = false;
+				if (type == TidyNode_Comment) matched = this->matchUntil(tokenPos, "<!--", "-->");
+				else if (type == TidyNode_CDATA) matched = this->matchUntil(tokenPos, "<![CDATA[", "]]>");
+				else if (type == TidyNode_Section) matched = this->matchUntil(tokenPos, "<![", "]>");
+				else if (type == TidyNode_DocType) matched = this->matchUntil(tokenPos, "<!", ">");
+				else if (type == TidyNode_ProcIns || type == TidyNode_XmlDecl || type == TidyNode_Php) matched = this->matchUntil(tokenPos, "<?", ">");
+				else matched = this->matchUntil(tokenPos, "<", ">"); // ASP and JSTE sections
+				if (!matched) return this->violation;
+			}
+		}
+
+		// nothing after the last tag but the line break tidy ends with
+		size_t endPos = this->pos;
+		if (endPos < this->code.size() && this->code[endPos] == '\r') endPos++;
+		if (endPos < this->code.size() && this->code[endPos] == '\n') endPos++;
+		if (endPos == this->code.size()) return std::string::npos;
+		this->fail(std::min(this->nextToken(), endPos));
+		return this->violation;
+	}
+
+	std::string checkStyle(CheckerSession& session)
+	{
+		if (session.styleChecked) return session.styleResponse;
+
+		// The style check keeps empty elements that the syntax check's options trim, which only changes the tree if
+		// tidy warned about trimming one, so code without warnings is checked against the session's own parse
+		std::unique_ptr<TidyContext, TidyContextReleaser> context{};
+		TidyDoc TD = nullptr;
+		if (session.syntax->setupError) session.styleResponse = session.syntax->setupError;
+		else if (session.parseResult == 0) TD = session.syntax->TD;
+		else
+		{
+			context.reset(TidyDocs.Acquire(TidyProfile::STYLE));
+			if (context->setupError) session.styleResponse = context->setupError;
+			else if (tidyParseString(context->TD, session.mbCode.c_str()) != 0) session.styleResponse = "Error:  cannot check style if there are syntax errors!"; // Welp, can't process style with syntax errors
+			else TD = context->TD;
+		}
+		if (TD)
+		{
+			const size_t violation = StyleValidator(session.mbCode).Check(TD);
+			if (violation == std::string::npos) session.styleResponse = "SUCCESS";
+			else
+			{
+				const size_t line = 1 + std::count(session.mbCode.begin(), session.mbCode.begin() + std::min(violation, session.mbCode.size()), '\n');
+				session.styleResponse = "Style Error on line " + std::to_string(line) + ": remember to indent and put new tags on new lines!";
+			}
+		}
+		session.styleChecked = true;
+		return session.styleResponse;
+	}
+
+	std::shared_ptr<const Selector> compileSelector(const std::string& command) // a "contains" query to the elements it names, outermost first
+	{
+		// First thing on the agenda is parsing the command.  The parameter defines tags, nesting, and attributes.  All that info needs to be extracted
+		std::string paramsStr = command.substr(8); // exclude the command name (contains) so we only have to parse the parameter
+		paramsStr.erase(std::remove_if(paramsStr.begin(), paramsStr.end(), isspace), paramsStr.end()); // remove whitespace
+		std::shared_ptr<Selector> selector = std::make_shared<Selector>();
+		std::vector<Elem>& elems = selector->elems;
+		const char withinDelim = '>';
+		size_t offset = paramsStr.length();
+		while (offset != std::string::npos) // back-to-front extract elems (right-most elem is lowest-level nesting)
+		{
+			const size_t withinFoundPos = paramsStr.rfind(withinDelim, offset);
+			std::string elemAndAttr = "";
+			if (withinFoundPos == std::string::npos) elemAndAttr = paramsStr.substr(0, offset + 1);
+			else elemAndAttr = paramsStr.substr(withinFoundPos + 1, offset - withinFoundPos);
+			const size_t openParenFoundPos = elemAndAttr.find('(');
+			const size_t closeParenFoundPos = elemAndAttr.find(')');
+			if ((openParenFoundPos == std::string::npos) || (closeParenFoundPos == std::string::npos)) break;
+			Elem elem = {};
+			elem.name = elemAndAttr.substr(0, openParenFoundPos);
+			if (closeParenFoundPos - openParenFoundPos != 1) // extract the attribute data
+			{
+				const std::string attributes = elemAndAttr.substr(openParenFoundPos + 1, closeParenFoundPos - openParenFoundPos - 1);
+				std::istringstream stream(attributes);
+				std::string attrKVPair = "";
+				while (std::getline(stream, attrKVPair, '|'))
+				{
+					const size_t equalsFoundPos = attrKVPair.find('=');
+					if (equalsFoundPos == std::string::npos) break;
+					const std::string key = attrKVPair.substr(0, equalsFoundPos);
+					const size_t firstQuotePos = attrKVPair.find('\"');
+					const size_t lastQuotePos = attrKVPair.rfind('\"');
+					if ((firstQuotePos == std::string::npos) || (lastQuotePos == std::string::npos) || (firstQuotePos == lastQuotePos)) break;
+					const std::string value = attrKVPair.substr(firstQuotePos + 1, lastQuotePos - firstQuotePos - 1);
+					elem.attributes.emplace(key, value);
+				}
+				if (elem.attributes.empty()) break;
+			}
+			elems.push_back(elem);
+			if(withinFoundPos != std::string::npos) offset = withinFoundPos - 1;
+			else break;
+		}
+		return selector;
+	}
+
+	class SelectorCache // compiled contains queries by their text, for as long as the DLL is loaded
+	{
+		private:
+			std::mutex mutex{};
+			std::unordered_map<std::string, std::shared_ptr<const Selector>> selectors{};
+		public:
+			std::shared_ptr<const Selector> Get(const std::string& command)
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				auto found = this->selectors.find(command);
+				if (found != this->selectors.end()) return found->second;
+				if (this->selectors.size() >= MaxCachedSelectors) this->selectors.clear(); // lessons only have so many queries; this just keeps a runaway caller bounded
+				std::shared_ptr<const Selector> selector = compileSelector(command);
+				this->selectors.emplace(command, selector);
+				return selector;
+			}
+	};
+
+	SelectorCache Selectors;
+
+	std::unique_ptr<DocumentIndex> indexDocument(TidyDoc TD)
+	{
+		std::unique_ptr<DocumentIndex> index = std::make_unique<DocumentIndex>();
+		index->head = tidyGetHead(TD);
+		index->body = tidyGetBody(TD);
+		std::vector<TidyNode> pending{ tidyGetRoot(TD) }; // a stack, so deeply nested pages can't overflow the real one
+		while (!pending.empty())
+		{
+			const TidyNode node = pending.back();
+			pending.pop_back();
+			IndexedNode& indexed = index->nodes[node];
+			for (TidyAttr attr = tidyAttrFirst(node); attr; attr = tidyAttrNext(attr))
+			{
+				const char* attrName = tidyAttrName(attr);
+				const char* attrValue = tidyAttrValue(attr); // nullptr for attributes without a value
+				if (attrName) indexed.attributes.emplace(attrName, attrValue ? attrValue : "");
+			}
+			for (TidyNode child = tidyGetChild(node); child; child = tidyGetNext(child))
+			{
+				const char* name = tidyNodeGetName(child);
+				if (!name) continue; // text has no name, and can't be matched anyway
+				indexed.children[name].push_back(child);
+				pending.push_back(child);
+			}
+		}
+		return index;
+	}
+
+	bool hasAttributes(const IndexedNode& node, const Elem& elem) // every attribute the query asks for, with its value
+	{
+		for (auto const & attrPair : elem.attributes)
+		{
+			const auto range = node.attributes.equal_range(attrPair.first);
+			bool found = false;
+			for (auto attr = range.first; attr != range.second && !found; ++attr) found = (attr->second == attrPair.second);
+			if (!found) return false;
+		}
+		return true;
+	}
+
+	std::string checkSyntax(const CheckerSession& session)
+	{
+		if (session.syntax->setupError) return session.syntax->setupError;
+		if (session.parseResult == 0) return "SUCCESS"; // no errors or warnings
+		return std::string(reinterpret_cast<const char*>(session.syntax->errorMessageBuffer.bp), session.syntax->errorMessageBuffer.size); // there are errors and/or warnings
+	}
+
+	std::string checkContains(CheckerSession& session, const std::string& mbCmdStr);
+
+	bool runQuery(CheckerSession& session, const std::string& command, std::string& response) // false if the query isn't one this checker knows
+	{
+		if (command == "StyleCheck") response = checkStyle(session);
+		else if (command.compare(0, 8, "contains") == 0) response = checkContains(session, command);
+		else return false;
+		return true;
+	}
+
+	std::string checkContains(CheckerSession& session, const std::string& mbCmdStr)
+	{
+		const std::shared_ptr<const Selector> selector = Selectors.Get(mbCmdStr); // compiled the first time this query is seen
+		const std::vector<Elem>& elems = selector->elems;
+
+		// Alright, time to check the parsed code for our contains statement
+		if (session.syntax->setupError) return session.syntax->setupError;
+		if (session.parseResult != 0) return "Error:  cannot check style if there are syntax errors!"; // Welp, can't process style with syntax errors
+		if (elems.empty()) return "Error:  the contains query is malformed";
+
+		// Check against code, level by level through the index
+		if (!session.index) session.index = indexDocument(session.syntax->TD);
+		const DocumentIndex& index = *session.index;
+		TidyNode curNode = (elems[0].name == "head") ? index.head : index.body;
+		size_t numSuccess = 1;
+		for (; numSuccess < elems.size(); numSuccess++)
+		{
+			const auto indexed = index.nodes.find(curNode);
+			if (indexed == index.nodes.end()) break;
+			const auto named = indexed->second.children.find(elems[numSuccess].name);
+			if (named == indexed->second.children.end()) break;
+			TidyNode match = nullptr;
+			for (const TidyNode child : named->second) // the first with the attributes, as the sibling walk found it
+			{
+				if (hasAttributes(index.nodes.at(child), elems[numSuccess]))
+				{
+					match = child;
+					break;
+				}
+			}
+			if (!match) break;
+			curNode = match;
+		}
+		if (numSuccess == elems.size()) return "SUCCESS";
+		return "The required \'" + elems[numSuccess].name + "\' element is missing or incorrect";
+	}
+}
+
+// ----- "public" required functions -----
+
+DLL void Identify(wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	const wchar_t* respStr = L"HTML Checker yaaaaay\0";
+	copyToRespBuf(respBuf, bufSize, respStr, wcslen(respStr));
+}
+
+DLL void CheckSyntax(const wchar_t* code, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	CheckerSession* session = OpenSession(code);
+	if (!session) return respondNoSession(respBuf);
+	SessionCheckSyntax(session, respBuf, bufSize);
+	CloseSession(session);
+}
+
+DLL void Query(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	CheckerSession* session = OpenSession(code);
+	if (!session) return respondNoSession(respBuf);
+	SessionQuery(session, command, respBuf, bufSize);
+	CloseSession(session);
+}
+
+// ----- session functions -----
+
+DLL CheckerSession* OpenSession(const wchar_t* code)
+{
+	try
+	{
+		const std::string mbCode = toUTF8(code, wcslen(code));
+		return OpenSessionUTF8(mbCode.data(), mbCode.length());
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+DLL CheckerSession* OpenSessionUTF8(const char* code, const size_t length)
+{
+	CheckerSession* session = new (std::nothrow) CheckerSession();
+	if (!session) return nullptr;
+	try
+	{
+		session->mbCode.assign(code, length); // tidy wants it terminated, and the style check compares against it
+		session->syntax = TidyDocs.Acquire(TidyProfile::SYNTAX);
+	}
+	catch (...)
+	{
+		delete session;
+		return nullptr;
+	}
+	if (!session->syntax->setupError) session->parseResult = tidyParseString(session->syntax->TD, session->mbCode.c_str()); // the one parse every check and query shares
+	return session;
+}
+
+DLL void SessionCheckSyntax(CheckerSession* session, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	try
+	{
+		respond(respBuf, bufSize, checkSyntax(*session));
+	}
+	catch (...)
+	{
+		respondNoSession(respBuf); // out of memory, the same as a session that couldn't be opened
+	}
+}
+
+DLL void SessionQuery(CheckerSession* session, const wchar_t* command, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	try
+	{
+		std::string response = "";
+		if (runQuery(*session, toUTF8(command, wcslen(command)), response)) respond(respBuf, bufSize, response);
+	}
+	catch (...)
+	{
+		respondNoSession(respBuf);
+	}
+}
+
+DLL size_t SessionRunAllUTF8(CheckerSession* session, const char* const* queries, const size_t* queryLengths, const size_t queryCount, void* resultBuf, const size_t resultBufSize)
+{
+	try
+	{
+		std::vector<std::string> queryList{};
+		queryList.reserve(queryCount);
+		for (size_t i = 0; i < queryCount; i++) queryList.emplace_back(queries[i], queryLengths[i]);
+		if (session->runAllRecords.empty() || queryList != session->runAllQueries) // evaluate everything once; a second call with a big enough buffer just copies
+		{
+			session->runAllQueries = queryList;
+			session->runAllRecords.clear();
+			session->runAllText.clear();
+			const auto record = [session](const CheckerOutcome outcome, const std::string& message)
+			{
+				CheckerResult result = {};
+				result.outcome = outcome;
+				if (outcome != CHECK_PASSED) // only failures carry a message
+				{
+					result.offset = static_cast<std::uint32_t>(session->runAllText.size());
+					result.length = static_cast<std::uint32_t>(message.size());
+					session->runAllText += message;
+				}
+				session->runAllRecords.push_back(result);
+			};
+			const std::string syntaxResponse = checkSyntax(*session);
+			record((syntaxResponse == "SUCCESS") ? CHECK_PASSED : CHECK_FAILED, syntaxResponse);
+			for (const std::string& query : queryList)
+			{
+				std::string response = "";
+				if (!runQuery(*session, query, response)) record(CHECK_UNSUPPORTED, "Unknown query: " + query);
+				else record((response == "SUCCESS") ? CHECK_PASSED : CHECK_FAILED, response);
+			}
+		}
+		const size_t recordBytes = session->runAllRecords.size() * sizeof(CheckerResult);
+		const size_t requiredSize = recordBytes + session->runAllText.size();
+		if (resultBuf && resultBufSize >= requiredSize)
+		{
+			memcpy(resultBuf, session->runAllRecords.data(), recordBytes);
+			if (!session->runAllText.empty()) memcpy(static_cast<char*>(resultBuf) + recordBytes, session->runAllText.data(), session->runAllText.size());
+		}
+		return requiredSize;
+	}
+	catch (...)
+	{
+		return 0; // out of memory - nothing could be evaluated
+	}
+}
+
+DLL size_t SessionRunAll(CheckerSession* session, const wchar_t* const* queries, const size_t queryCount, void* resultBuf, const size_t resultBufSize)
+{
+	try
+	{
+		const std::vector<std::wstring> queryList(queries, queries + queryCount);
+		if (session->runAllWideRecords.empty() || queryList != session->runAllWideQueries) // run them as UTF-8, then convert the answers once
+		{
+			std::vector<std::string> mbQueries{};
+			std::vector<const char*> mbQueryStrings{};
+			std::vector<size_t> mbQueryLengths{};
+			for (const std::wstring& query : queryList) mbQueries.push_back(toUTF8(query.data(), query.length()));
+			for (const std::string& query : mbQueries)
+			{
+				mbQueryStrings.push_back(query.data());
+				mbQueryLengths.push_back(query.length());
+			}
+			if (SessionRunAllUTF8(session, mbQueryStrings.data(), mbQueryLengths.data(), queryCount, nullptr, 0) == 0) return 0;
+			session->runAllWideQueries = queryList;
+			session->runAllWideRecords.clear();
+			session->runAllWideText.clear();
+			for (CheckerResult result : session->runAllRecords)
+			{
+				const std::wstring message = fromUTF8(session->runAllText.data() + result.offset, result.length);
+				result.offset = static_cast<std::uint32_t>(session->runAllWideText.size());
+				result.length = static_cast<std::uint32_t>(message.size());
+				session->runAllWideText += message;
+				session->runAllWideRecords.push_back(result);
+			}
+		}
+		const size_t recordBytes = session->runAllWideRecords.size() * sizeof(CheckerResult);
+		const size_t requiredSize = recordBytes + session->runAllWideText.size() * sizeof(wchar_t);
+		if (resultBuf && resultBufSize >= requiredSize)
+		{
+			memcpy(resultBuf, session->runAllWideRecords.data(), recordBytes);
+			if (!session->runAllWideText.empty()) memcpy(static_cast<char*>(resultBuf) + recordBytes, session->runAllWideText.data(), session->runAllWideText.size() * sizeof(wchar_t));
+		}
+		return requiredSize;
+	}
+	catch (...)
+	{
+		return 0; // out of memory - nothing could be evaluated
+	}
+}
+
+DLL void CloseSession(CheckerSession* session)
+{
+	if (!session) return;
+	TidyDocs.Release(session->syntax); // back to the pool, unless the code had errors or warnings
+	delete session;
+}
+
+// ----- obscured functions -----
+DLL void CheckStyle(const wchar_t* code, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	CheckerSession* session = OpenSession(code);
+	if (!session) return respondNoSession(respBuf);
+	try
+	{
+		respond(respBuf, bufSize, checkStyle(*session));
+	}
+	catch (...)
+	{
+		respondNoSession(respBuf);
+	}
+	CloseSession(session);
+}
+
+DLL void Contains(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize)
+{
+	if (!checkRespBufSize(respBuf, bufSize)) return;
+	CheckerSession* session = OpenSession(code);
+	if (!session) return respondNoSession(respBuf);
+	try
+	{
+		respond(respBuf, bufSize, checkContains(*session, toUTF8(command, wcslen(command))));
+	}
+	catch (...)
+	{
+		respondNoSession(respBuf);
+	}
+	CloseSession(session);
+}
+
+// ----- helper functions -----
+
+DLL bool checkRespBufSize(wchar_t* respBuf, const size_t bufSize)
+{
+	if (bufSize < 2)  // forbidden; at least 2 chars needed for error reporting
+	{
+		if (bufSize == 1) respBuf[0] = L'0';
+		return false;
+	}
+	else return true;
+}
+
+DLL void copyToRespBuf(wchar_t* respBuf, const size_t respBufSize, const wchar_t* sourceBuf, const size_t sourceBufSize)
+{
+	try
+	{
+		const size_t charsToCopy = (respBufSize - 1 < sourceBufSize) ? respBufSize - 1 : sourceBufSize; // always leave room for the terminator
+		wmemcpy(respBuf, sourceBuf, charsToCopy);
+		respBuf[charsToCopy] = L'\0';
+		//const errno_t err = wcsncpy_s(respBuf, respBufSize, sourceBuf, sourceBufSize);
+		//if ( (err != 0) && (respBuf[0] == L'\0') ) respBuf[1] = static_cast<wchar_t>(err);
+	}
+	catch (...){}
 }
\ No newline at end of file
@@ -1,55 +1,82 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-#pragma once
-
-#ifndef HTMLCHECKER_HPP
-#define HTMLCHECKER_CPP
-
-// STL headers
-#include <string>
-#include <map>
-
-// types
-#define DLL extern "C" __declspec(dllexport)
-struct Elem
-{
-	std::string name = "";
-	std::map<std::string, std::string> attributes; // (attr_name,attr_val)
-};
-
-// variables
-DLL const size_t respBufSize = 64;
-
-// "public" required functions
-DLL void Identify(wchar_t* respBuf, const size_t bufSize);
-DLL void CheckSyntax(const wchar_t* code, wchar_t* respBuf, const size_t bufSize);
-DLL void Query(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize);
-
-// obscured functions
-DLL void CheckStyle(const wchar_t* code, wchar_t* respBuf, const size_t bufSize);
-DLL void Contains(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize);
-
-// helper functions
-DLL bool checkRespBufSize(wchar_t* respBuf, const size_t bufSize);
-DLL void copyToRespBuf(wchar_t* respBuf, const size_t respBufSize, const wchar_t* sourceBuf, const size_t sourceBufSize);
-DLL bool elemContainsExactAttributes(const Elem& elem, TidyNode& childNode);
-
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef HTMLCHECKER_HPP
+#define HTMLCHECKER_CPP
+
+// STL headers
+#include <string>
+#include <map>
+#include <vector>
+#include <cstdint>
+
+// types
+#define DLL extern "C" __declspec(dllexport)
+struct Elem
+{
+	std::string name = "";
+	std::map<std::string, std::string> attributes; // (attr_name,attr_val)
+};
+struct Selector // a contains query compiled once: the elements it names, outermost first, each nested in the one before
+{
+	std::vector<Elem> elems{};
+};
+struct CheckerSession; // the code of one Check, converted to UTF-8 and parsed once
+struct CheckerResult // SessionRunAll's answer to one check; the records are followed by their messages' text
+{
+	std::uint32_t outcome = 0; // CheckerOutcome
+	std::uint32_t offset = 0; // in characters (wchar_ts, or chars from SessionRunAllUTF8) from the end of the last record
+	std::uint32_t length = 0; // in characters, no terminator
+};
+enum CheckerOutcome : std::uint32_t
+{
+	CHECK_PASSED = 0,
+	CHECK_FAILED = 1,
+	CHECK_UNSUPPORTED = 2, // the query isn't one this checker knows
+};
+
+// variables
+DLL const size_t respBufSize = 64;
+
+// "public" required functions
+DLL void Identify(wchar_t* respBuf, const size_t bufSize);
+DLL void CheckSyntax(const wchar_t* code, wchar_t* respBuf, const size_t bufSize);
+DLL void Query(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize);
+
+// session functions - parse the code once, then check its syntax and run any number of queries on the same document
+DLL CheckerSession* OpenSession(const wchar_t* code); // nullptr if the session couldn't be created
+DLL CheckerSession* OpenSessionUTF8(const char* code, const size_t length); // the same, without converting the code from UTF-16
+DLL void SessionCheckSyntax(CheckerSession* session, wchar_t* respBuf, const size_t bufSize);
+DLL void SessionQuery(CheckerSession* session, const wchar_t* command, wchar_t* respBuf, const size_t bufSize);
+DLL size_t SessionRunAll(CheckerSession* session, const wchar_t* const* queries, const size_t queryCount, void* resultBuf, const size_t resultBufSize); // the syntax check and every query; returns the bytes the results need, and fills resultBuf only if it is that big
+DLL size_t SessionRunAllUTF8(CheckerSession* session, const char* const* queries, const size_t* queryLengths, const size_t queryCount, void* resultBuf, const size_t resultBufSize); // the same with UTF-8 queries and messages; offsets and lengths count chars
+DLL void CloseSession(CheckerSession* session);
+
+// obscured functions
+DLL void CheckStyle(const wchar_t* code, wchar_t* respBuf, const size_t bufSize);
+DLL void Contains(const wchar_t* code, const wchar_t* command, wchar_t* respBuf, const size_t bufSize);
+
+// helper functions
+DLL bool checkRespBufSize(wchar_t* respBuf, const size_t bufSize);
+DLL void copyToRespBuf(wchar_t* respBuf, const size_t respBufSize, const wchar_t* sourceBuf, const size_t sourceBufSize);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,355 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// Headless benchmarks for the syntax highlighter, the lesson parser and the lesson catalog loader.
+// Every case prints one JSON object per line:
+//	{"bench":"highlighter","language":"HTML","bytes":1024,"iterations":812,"mb_per_s":...,"allocs_per_kb":...,"p50_us":...,"p99_us":...}
+// except highlight_apply, which counts the editor calls one highlighting pass costs:
+//	{"bench":"highlight_apply","language":"HTML","bytes":1024,"runs":...,"batches":1,"per_run_runs":...,"per_run_batches":...}
+// Languages that don't ship a SYNTAX.txt are highlighted with a corpus grammar, so every language is measured.
+// Usage: learncs_bench [--languages <shipped Languages dir>] [--sizes 1K,10K,100K,1M,10M] [--seconds <per case>] [--seed <n>]
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <streambuf>
+#include <algorithm> // std::sort, std::fill, std::any_of
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory> // std::make_unique
+
+// Program Headers
+#include "Corpus.hpp"
+#include "../src/SyntaxHighlighter.hpp"
+#include "../src/HighlightSink.hpp"
+#include "../src/LessonParser.hpp"
+#include "../src/LessonCatalog.hpp"
+#include "../src/CourseArchive.hpp"
+#include "../src/CatalogCache.hpp"
+
+namespace
+{
+	std::atomic<size_t> allocationCount{ 0 };
+}
+
+// every allocation in the process goes through here, so the cases can count them
+void* operator new(const size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size == 0 ? 1 : size)) return memory;
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+namespace ASP
+{
+	class NullBuffer : public std::wstreambuf // the engines print their debug output to wcout, which isn't what's being measured
+	{
+		protected:
+			int_type overflow(int_type c) override
+			{
+				return traits_type::not_eof(c);
+			}
+	};
+
+	struct BenchOptions
+	{
+		std::filesystem::path languages = L"LearnCS++/Languages";
+		std::vector<size_t> sizes{ 1024, 10 * 1024, 100 * 1024, 1024 * 1024, 10 * 1024 * 1024 };
+		double seconds = 1.0;
+		unsigned int seed = 1;
+	};
+
+	struct BenchResult
+	{
+		size_t iterations = 0;
+		double totalSeconds = 0.0;
+		size_t allocations = 0;
+		std::vector<double> latencies{}; // microseconds
+	};
+
+	size_t ParseSize(const std::string& str)
+	{
+		size_t multiplier = 1;
+		std::string digits = str;
+		if (!digits.empty() && (digits.back() == 'K' || digits.back() == 'k')) multiplier = 1024;
+		if (!digits.empty() && (digits.back() == 'M' || digits.back() == 'm')) multiplier = 1024 * 1024;
+		if (multiplier != 1) digits.pop_back();
+		return std::stoul(digits) * multiplier;
+	}
+
+	BenchOptions ParseOptions(const int argc, char** argv)
+	{
+		BenchOptions options{};
+		for (int arg = 1; arg + 1 < argc; arg += 2)
+		{
+			const std::string name = argv[arg];
+			const std::string value = argv[arg + 1];
+			if (name == "--languages") options.languages = std::filesystem::absolute(value);
+			else if (name == "--seconds") options.seconds = std::stod(value);
+			else if (name == "--seed") options.seed = static_cast<unsigned int>(std::stoul(value));
+			else if (name == "--sizes")
+			{
+				options.sizes.clear();
+				size_t begin = 0;
+				while (begin <= value.length())
+				{
+					size_t end = value.find(',', begin);
+					if (end == std::string::npos) end = value.length();
+					options.sizes.push_back(ParseSize(value.substr(begin, end - begin)));
+					begin = end + 1;
+				}
+			}
+			else throw 1;
+		}
+		options.languages = std::filesystem::absolute(options.languages);
+		return options;
+	}
+
+	BenchResult Measure(const double seconds, const std::function<void()>& body) // at least 5 iterations, then until the time is up
+	{
+		const size_t minIterations = 5;
+		const size_t maxIterations = 100000;
+		BenchResult result{};
+		const size_t allocationsBefore = allocationCount.load();
+		while (result.iterations < maxIterations && (result.iterations < minIterations || result.totalSeconds < seconds))
+		{
+			const auto start = std::chrono::steady_clock::now();
+			body();
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			result.latencies.push_back(elapsed.count() * 1e6);
+			result.totalSeconds += elapsed.count();
+			result.iterations++;
+		}
+		result.allocations = allocationCount.load() - allocationsBefore;
+		return result;
+	}
+
+	double Percentile(std::vector<double> latencies, const double percentile) // nearest rank
+	{
+		std::sort(latencies.begin(), latencies.end());
+		size_t rank = static_cast<size_t>(percentile / 100.0 * latencies.size() + 0.999999);
+		if (rank == 0) rank = 1;
+		return latencies[std::min(rank, latencies.size()) - 1];
+	}
+
+	std::string Narrow(const std::wstring& str) // the language names are plain ASCII
+	{
+		return std::string(str.begin(), str.end());
+	}
+
+	void Report(const std::string& bench, const std::wstring& language, const size_t bytes, const BenchResult& result)
+	{
+		const double kilobytes = bytes / 1024.0;
+		char line[512] = {};
+		std::snprintf(line, sizeof(line), "{\"bench\":\"%s\",\"language\":\"%s\",\"bytes\":%zu,\"iterations\":%zu,\"mb_per_s\":%.3f,\"allocs_per_kb\":%.3f,\"p50_us\":%.1f,\"p99_us\":%.1f}",
+					  bench.c_str(), Narrow(language).c_str(), bytes, result.iterations,
+					  (bytes * result.iterations) / (1024.0 * 1024.0) / result.totalSeconds,
+					  result.allocations / (kilobytes * result.iterations),
+					  Percentile(result.latencies, 50.0), Percentile(result.latencies, 99.0));
+		std::cout << line << std::endl;
+	}
+
+	void BenchHighlighter(const BenchOptions& options, const size_t bytes)
+	{
+		for (const Corpus::LanguageInfo& language : Corpus::Languages)
+		{
+			const std::wstring code = Corpus::GenerateCode(language.name, bytes / 2, options.seed); // bytes of UTF-16, which is how the lesson files store it
+			const BenchResult result = Measure(options.seconds, [&]()
+			{
+				SyntaxHighlighter SH(language.name, language.langID, code);
+				if (SH.countRuns() == 0 && !code.empty()) throw 2;
+			});
+			Report("highlighter", language.name, bytes, result);
+		}
+	}
+
+	void BenchHighlightApply(const BenchOptions& options, const size_t bytes)
+	{
+		// One highlighting pass through HighlightBatch, which is how HighlightWorker::Apply hands its runs to the control,
+		// against the baseline of one batch per run that SCEdit used to repaint it with.  Both have to paint every character the same color.
+		for (const Corpus::LanguageInfo& language : Corpus::Languages)
+		{
+			const std::wstring code = Corpus::GenerateCode(language.name, bytes / 2, options.seed);
+			const SyntaxHighlighter SH(language.name, language.langID, code);
+			const SyntaxHighlighter::RunList& runs = SH.getRuns();
+			RecordingHighlightSink perRun{};
+			RecordingHighlightSink batched{};
+			HighlightBatch batch{};
+			HighlightSink::Color color = 0;
+			for (size_t run = 0; run < SH.countRuns(); run++)
+			{
+				const size_t beginPos = runs.offsets[run];
+				const size_t endPos = beginPos + runs.lengths[run];
+				if (!SH.isLineBreak(run))
+				{
+					color = SH.getRunColor(run);
+					perRun.BeginBatch();
+					perRun.ApplyRun(HighlightSink::Run{ beginPos, endPos, color });
+					perRun.EndBatch();
+				}
+				batch.Add(beginPos, endPos, color); // a line break takes the color before it, so runs carry on across lines
+			}
+			batch.Flush(batched);
+
+			if (batched.countBatches() > 1 || batched.getRuns().size() > perRun.getRuns().size()) throw 6;
+			std::vector<HighlightSink::Color> painted(code.length(), 0);
+			for (const HighlightSink::Run& run : batched.getRuns()) std::fill(painted.begin() + run.beginPos, painted.begin() + run.endPos, run.color);
+			for (const HighlightSink::Run& run : perRun.getRuns())
+			{
+				if (std::any_of(painted.begin() + run.beginPos, painted.begin() + run.endPos, [&run](const HighlightSink::Color c) { return c != run.color; })) throw 7;
+			}
+			std::cout << "{\"bench\":\"highlight_apply\",\"language\":\"" << Narrow(language.name) << "\",\"bytes\":" << bytes
+					  << ",\"runs\":" << batched.getRuns().size() << ",\"batches\":" << batched.countBatches()
+					  << ",\"per_run_runs\":" << perRun.getRuns().size() << ",\"per_run_batches\":" << perRun.countBatches() << "}" << std::endl;
+		}
+	}
+
+	void BenchParser(const BenchOptions& options, const size_t bytes, LangList& langs)
+	{
+		for (const Corpus::LanguageInfo& language : Corpus::Languages)
+		{
+			const std::filesystem::path lessonPath = std::filesystem::path(L"Parser") / (language.name + L"_000.txt");
+			std::filesystem::create_directories(lessonPath.parent_path());
+			Corpus::WriteLessonFile(lessonPath, Corpus::GenerateLesson(language.name, bytes / 2, options.seed));
+			const size_t fileSize = static_cast<size_t>(std::filesystem::file_size(lessonPath));
+			const BenchResult result = Measure(options.seconds, [&]()
+			{
+				LessonParser parser(lessonPath.wstring(), &langs);
+				parser.parse();
+				if (!parser.getLessonData().SCBox) throw 3;
+			});
+			Report("parser", language.name, fileSize, result);
+		}
+	}
+
+	void BenchCatalog(const BenchOptions& options, const size_t bytes)
+	{
+		// a fresh tree of roughly bytes of lessons per language, loaded the way the dashboard does
+		const std::filesystem::path catalogRoot = std::filesystem::current_path() / L"Catalog";
+		std::filesystem::remove_all(catalogRoot);
+		Corpus::BuildLanguageTree(catalogRoot, options.languages, bytes / 2, options.seed);
+		const std::filesystem::path workRoot = std::filesystem::current_path();
+		std::filesystem::current_path(catalogRoot);
+		const BenchResult result = Measure(options.seconds, [&]()
+		{
+			std::filesystem::remove(CatalogCache::FileName); // every lesson read, as on the first start
+			LangList langs{};
+			LessonCatalog::Load(&langs);
+			if (langs.size() != Corpus::Languages.size()) throw 4;
+		});
+		Report("catalog", L"all", bytes * Corpus::Languages.size(), result);
+
+		// the same tree, unchanged since the CatalogCache was saved
+		const BenchResult cachedResult = Measure(options.seconds, [&]()
+		{
+			LangList langs{};
+			LessonCatalog::Load(&langs);
+			if (langs.size() != Corpus::Languages.size()) throw 4;
+		});
+		Report("catalog_cached", L"all", bytes * Corpus::Languages.size(), cachedResult);
+
+		// the same tree, packed into a CourseArchive
+		if (!CourseArchive::Pack(CourseArchive::FileName) || !CourseArchive::Open()) throw 5;
+		const BenchResult archiveResult = Measure(options.seconds, [&]()
+		{
+			LangList langs{};
+			LessonCatalog::Load(&langs);
+			if (langs.size() != Corpus::Languages.size()) throw 4;
+		});
+		CourseArchive::Close();
+		std::filesystem::current_path(workRoot);
+		Report("catalog_archive", L"all", bytes * Corpus::Languages.size(), archiveResult);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace ASP;
+	NullBuffer nullBuffer{};
+	std::wstreambuf* const wcoutBuffer = std::wcout.rdbuf(&nullBuffer);
+	int result = 0;
+	try
+	{
+		const BenchOptions options = ParseOptions(argc, argv);
+
+		// the highlighter and the parser look for Languages/ in the working directory, so work in a scratch copy of it
+		const std::filesystem::path workRoot = std::filesystem::temp_directory_path() / L"learncs_bench";
+		std::filesystem::remove_all(workRoot);
+		Corpus::BuildLanguageTree(workRoot, options.languages, 0, options.seed);
+		std::filesystem::current_path(workRoot);
+		LangList langs{};
+		std::map<std::wstring, LessonGroup> noLessonGroups{};
+		for (const Corpus::LanguageInfo& language : Corpus::Languages) langs.emplace(language.langID, std::make_unique<Language>(language.name, language.langID, noLessonGroups));
+
+		for (const size_t bytes : options.sizes)
+		{
+			BenchHighlighter(options, bytes);
+			BenchHighlightApply(options, bytes);
+			BenchParser(options, bytes, langs);
+			BenchCatalog(options, bytes);
+		}
+		std::filesystem::current_path(workRoot.parent_path());
+		std::filesystem::remove_all(workRoot);
+	}
+	catch (int _errno)
+	{
+		std::wcerr << L"bench error: " << _errno << L'\n';
+		result = 1;
+	}
+	catch (const std::exception& e)
+	{
+		std::wcerr << L"bench error: " << e.what() << L'\n';
+		result = 1;
+	}
+	std::wcout.rdbuf(wcoutBuffer); // nullBuffer doesn't outlive main
+	return result;
+}
@@ -0,0 +1,145 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <filesystem>
+
+// Project Headers
+#include "Corpus.hpp"
+
+namespace ASP
+{
+	const std::vector<Corpus::LanguageInfo> Corpus::Languages{ {L"000", L"HTML"}, {L"001", L"CSS"}, {L"002", L"JS"}, {L"003", L"PHP"}, {L"004", L"SQL"}, {L"005", L"C++"} };
+
+	namespace
+	{
+		using Snippets = std::vector<std::wstring>;
+
+		const Snippets& SnippetsFor(const std::wstring& language) // short, realistic lines a student might type; "@" is replaced by a word
+		{
+			static const Snippets html{ L"<div class=\"@\">", L"  <p>@ and @</p>", L"  <a href=\"@.html\">@</a>", L"<!-- @ -->", L"  <img src=\"@.png\" alt=\"@\">", L"</div>", L"<h1 id=\"@\">@</h1>", L"<ul><li>@</li><li>@</li></ul>" };
+			static const Snippets css{ L".@ {", L"  color: #@;", L"  margin: 0 auto;", L"}", L"/* @ */", L"#@ > p:hover { font-size: 12px; }", L"@media (max-width: 600px) { .@ { display: none; } }" };
+			static const Snippets js{ L"function @(a, b) {", L"  var @ = \"@\";", L"  return a + b; // @", L"}", L"/* @ */", L"if (@ === '@') { console.log(@); }", L"const @ = [1, 2, 3].map(x => x * 2);" };
+			static const Snippets php{ L"<?php", L"$@ = \"@\";", L"echo '@' . $@; // @", L"function @($a) { return $a * 2; }", L"/* @ */", L"?>", L"<p><?= htmlspecialchars($@) ?></p>" };
+			static const Snippets sql{ L"SELECT @, @ FROM @", L"WHERE @ = '@' AND id > 10;", L"-- @", L"INSERT INTO @ (a, b) VALUES ('@', 2);", L"/* @ */", L"UPDATE @ SET @ = NULL WHERE @ LIKE '%@%';", L"CREATE TABLE @ (id INT PRIMARY KEY, name VARCHAR(64));" };
+			static const Snippets cpp{ L"#include <@>", L"int @(int a, int b)", L"{", L"  std::cout << \"@\" << a; // @", L"  return a + b;", L"}", L"/* @ */", L"for (auto const & @ : @) std::wcout << @ << L'\\n';" };
+			if (language == L"HTML") return html;
+			if (language == L"CSS") return css;
+			if (language == L"JS") return js;
+			if (language == L"PHP") return php;
+			if (language == L"SQL") return sql;
+			return cpp;
+		}
+	}
+
+	std::wstring Corpus::GenerateCode(const std::wstring& language, const size_t length, const unsigned int seed)
+	{
+		static const std::vector<std::wstring> words{ L"main", L"content", L"nav", L"item", L"title", L"value", L"student", L"lesson", L"x", L"counter" };
+		const Snippets& snippets = SnippetsFor(language);
+		std::mt19937 rng(seed);
+		std::wstring code = L"";
+		code.reserve(length + 128);
+		while (code.length() < length)
+		{
+			if (!code.empty()) code += L"\r\n";
+			for (const wchar_t c : snippets[rng() % snippets.size()])
+			{
+				if (c == L'@') code += words[rng() % words.size()];
+				else code += c;
+			}
+		}
+		code.resize(length);
+		if (!code.empty() && code.back() == L'\r') code.back() = L' '; // don't cut a line break in half
+		return code;
+	}
+
+	std::wstring Corpus::GenerateSyntax(const std::wstring& language) // comments, strings and a few keywords, enough to give the highlighter the kind of work a real one would
+	{
+		using Rules = std::vector<std::vector<std::wstring>>; // type, begin, end, color
+		static const Rules css{ {L"DELIM", L"/*", L"*/", L"green"}, {L"DELIM", L"\"", L"\"", L"yellow"}, {L"KEY", L"{", L"", L"red"}, {L"KEY", L"}", L"", L"red"}, {L"KEY", L":", L"", L"cyan"}, {L"KEY", L";", L"", L"cyan"}, {L"KEY", L"@media", L"", L"magenta"} };
+		static const Rules js{ {L"DELIM", L"/*", L"*/", L"green"}, {L"DELIM", L"\"", L"\"", L"yellow"}, {L"DELIM", L"'", L"'", L"yellow"}, {L"KEY", L"//", L"", L"green"}, {L"KEY", L"function", L"", L"blue"}, {L"KEY", L"var", L"", L"blue"}, {L"KEY", L"const", L"", L"blue"}, {L"KEY", L"return", L"", L"blue"}, {L"KEY", L"if", L"", L"blue"}, {L"KEY", L"=>", L"", L"cyan"} };
+		static const Rules php{ {L"DELIM", L"/*", L"*/", L"green"}, {L"DELIM", L"\"", L"\"", L"yellow"}, {L"DELIM", L"'", L"'", L"yellow"}, {L"KEY", L"<?php", L"", L"red"}, {L"KEY", L"?>", L"", L"red"}, {L"KEY", L"$", L"", L"cyan"}, {L"KEY", L"function", L"", L"blue"}, {L"KEY", L"echo", L"", L"blue"}, {L"KEY", L"return", L"", L"blue"} };
+		static const Rules sql{ {L"DELIM", L"/*", L"*/", L"green"}, {L"DELIM", L"'", L"'", L"yellow"}, {L"KEY", L"--", L"", L"green"}, {L"KEY", L"SELECT", L"", L"blue"}, {L"KEY", L"FROM", L"", L"blue"}, {L"KEY", L"WHERE", L"", L"blue"}, {L"KEY", L"INSERT INTO", L"", L"blue"}, {L"KEY", L"VALUES", L"", L"blue"}, {L"KEY", L"UPDATE", L"", L"blue"}, {L"KEY", L"SET", L"", L"blue"}, {L"KEY", L"CREATE TABLE", L"", L"blue"} };
+		static const Rules cpp{ {L"DELIM", L"/*", L"*/", L"green"}, {L"DELIM", L"\"", L"\"", L"yellow"}, {L"KEY", L"//", L"", L"green"}, {L"KEY", L"#include", L"", L"red"}, {L"KEY", L"int", L"", L"blue"}, {L"KEY", L"return", L"", L"blue"}, {L"KEY", L"for", L"", L"blue"}, {L"KEY", L"auto", L"", L"blue"}, {L"KEY", L"const", L"", L"blue"}, {L"KEY", L"std::", L"", L"cyan"} };
+		static const Rules html{ {L"DELIM", L"<!--", L"-->", L"green"}, {L"DELIM", L"\"", L"\"", L"yellow"}, {L"KEY", L"<", L"", L"red"}, {L"KEY", L">", L"", L"red"} };
+		const Rules* rules = &cpp;
+		if (language == L"HTML") rules = &html;
+		else if (language == L"CSS") rules = &css;
+		else if (language == L"JS") rules = &js;
+		else if (language == L"PHP") rules = &php;
+		else if (language == L"SQL") rules = &sql;
+		std::wstring syntax = L"DEFAULT\t|=|\t\t|=|\t\t|=|\twhite";
+		for (const std::vector<std::wstring>& rule : *rules) syntax += L"\r\n" + rule[0] + L"\t|=|\t" + rule[1] + L"\t|=|\t" + rule[2] + L"\t|=|\t" + rule[3];
+		return syntax;
+	}
+
+	std::wstring Corpus::GenerateLesson(const std::wstring& language, const size_t length, const unsigned int seed) // the same commands the shipped lessons use
+	{
+		std::wstring lesson = L"TITLE Benchmark lesson " + std::to_wstring(seed) + L"\r\n";
+		lesson += L"LBOX Type the code on the right, then press Check Code.\r\nIt is generated, so don't try too hard to make sense of it.\r\nEND\r\n";
+		lesson += L"SCBOX " + language + L"\r\n";
+		lesson += GenerateCode(language, (length > lesson.length() + 64) ? length - lesson.length() - 64 : 1, seed);
+		lesson += L"\r\nEND\r\nCCBUTTON\r\nCHECKSYNTAX\r\nEND";
+		return lesson;
+	}
+
+	void Corpus::WriteLessonFile(const std::filesystem::path& path, const std::wstring& text) // UTF-16LE with a BOM, like the shipped lesson files
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.put(static_cast<char>(0xFF));
+		file.put(static_cast<char>(0xFE));
+		for (const wchar_t c : text)
+		{
+			file.put(static_cast<char>(c & 0xFF));
+			file.put(static_cast<char>((c >> 8) & 0xFF));
+		}
+	}
+
+	void Corpus::BuildLanguageTree(const std::filesystem::path& root, const std::filesystem::path& shippedLanguages, const size_t length, const unsigned int seed)
+	{
+		// Languages/###_Name/### Group/Name_###.txt, with roughly length characters of lessons in every language, in 1 KB lessons
+		const size_t lessonLength = 1024;
+		const size_t lessonsPerLanguage = (length + lessonLength - 1) / lessonLength;
+		const size_t lessonsPerGroup = 50;
+		for (const LanguageInfo& language : Languages)
+		{
+			const std::wstring dirName = language.langID + L"_" + language.name;
+			const std::filesystem::path languageDir = root / L"Languages" / dirName;
+			std::filesystem::create_directories(languageDir);
+			const std::filesystem::path shippedSyntax = shippedLanguages / dirName / L"SYNTAX.txt";
+			if (std::filesystem::exists(shippedSyntax)) std::filesystem::copy_file(shippedSyntax, languageDir / L"SYNTAX.txt", std::filesystem::copy_options::overwrite_existing);
+			else WriteLessonFile(languageDir / L"SYNTAX.txt", GenerateSyntax(language.name)); // so the highlighter has something to run for every language
+			for (size_t lesson = 0; lesson < lessonsPerLanguage; lesson++)
+			{
+				wchar_t groupName[16] = {};
+				wchar_t lessonName[16] = {};
+				swprintf(groupName, 16, L"%03zu Group %zu", lesson / lessonsPerGroup, lesson / lessonsPerGroup);
+				swprintf(lessonName, 16, L"_%03zu.txt", lesson % lessonsPerGroup);
+				const std::filesystem::path groupDir = languageDir / groupName;
+				std::filesystem::create_directories(groupDir);
+				WriteLessonFile(groupDir / (language.name + lessonName), GenerateLesson(language.name, lessonLength, seed + static_cast<unsigned int>(lesson)));
+			}
+		}
+	}
+}
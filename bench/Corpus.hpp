@@ -0,0 +1,50 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef CORPUS_HPP
+#define CORPUS_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace ASP
+{
+	class Corpus // deterministic, synthetic source code and lesson trees for the benchmarks
+	{
+		public:
+			struct LanguageInfo
+			{
+				std::wstring langID = L"";
+				std::wstring name = L"";
+			};
+			static const std::vector<LanguageInfo> Languages; // the languages LearnCS++ ships with
+			static std::wstring GenerateCode(const std::wstring& language, const size_t length, const unsigned int seed);
+			static std::wstring GenerateSyntax(const std::wstring& language); // a SYNTAX.txt for the languages that don't ship one
+			static std::wstring GenerateLesson(const std::wstring& language, const size_t length, const unsigned int seed);
+			static void WriteLessonFile(const std::filesystem::path& path, const std::wstring& text);
+			static void BuildLanguageTree(const std::filesystem::path& root, const std::filesystem::path& shippedLanguages, const size_t length, const unsigned int seed);
+	};
+}
+
+#endif
@@ -0,0 +1,82 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef BINARYIO_HPP
+#define BINARYIO_HPP
+
+// STL headers
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint>
+
+namespace ASP
+{
+	// little-endian writing and bounds-checked reading for the binary formats (LessonBinary, CourseArchive)
+	class BlobWriter
+	{
+		public:
+			std::vector<unsigned char> bytes{};
+			void u16(const std::uint16_t value)
+			{
+				for (int shift = 0; shift < 16; shift += 8) this->bytes.push_back(static_cast<unsigned char>(value >> shift));
+			}
+			void u32(const std::uint32_t value)
+			{
+				for (int shift = 0; shift < 32; shift += 8) this->bytes.push_back(static_cast<unsigned char>(value >> shift));
+			}
+			void u64(const std::uint64_t value)
+			{
+				for (int shift = 0; shift < 64; shift += 8) this->bytes.push_back(static_cast<unsigned char>(value >> shift));
+			}
+			void patch32(const size_t pos, const std::uint32_t value)
+			{
+				for (int shift = 0; shift < 32; shift += 8) this->bytes[pos + shift / 8] = static_cast<unsigned char>(value >> shift);
+			}
+			void patch64(const size_t pos, const std::uint64_t value)
+			{
+				for (int shift = 0; shift < 64; shift += 8) this->bytes[pos + shift / 8] = static_cast<unsigned char>(value >> shift);
+			}
+	};
+
+	class BlobReader // throws 6 on anything that runs off the end of the blob
+	{
+		private:
+			const unsigned char* bytes = nullptr;
+			size_t size = 0;
+		public:
+			BlobReader(const unsigned char* _bytes, const size_t _size) noexcept : bytes(_bytes), size(_size) {};
+			std::uint64_t read(const size_t pos, const size_t width) const
+			{
+				if (pos > this->size || width > this->size - pos) throw 6;
+				std::uint64_t value = 0;
+				for (size_t byte = 0; byte < width; byte++) value |= static_cast<std::uint64_t>(this->bytes[pos + byte]) << (8 * byte);
+				return value;
+			}
+			const unsigned char* at(const size_t pos, const size_t length) const
+			{
+				if (pos > this->size || length > this->size - pos) throw 6;
+				return this->bytes + pos;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,146 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring> // std::memcmp
+
+// Project Headers
+#include "CatalogCache.hpp"
+#include "BinaryIO.hpp"
+
+namespace ASP
+{
+	const std::wstring CatalogCache::FileName = L"catalog.bin";
+
+	namespace
+	{
+		const char Magic[4] = { 'L', 'C', 'S', 'C' };
+		const size_t HeaderSize = 16;
+
+		void WriteString(BlobWriter& writer, const std::wstring& str)
+		{
+			const size_t lengthPos = writer.bytes.size();
+			writer.u32(0);
+			Platform::EncodeUTF16(str, writer.bytes);
+			writer.patch32(lengthPos, static_cast<std::uint32_t>((writer.bytes.size() - lengthPos - 4) / 2));
+		}
+
+		std::wstring ReadString(const BlobReader& reader, size_t& pos)
+		{
+			const size_t length = static_cast<size_t>(reader.read(pos, 4));
+			std::wstring str = L"";
+			Platform::DecodeUTF16(reader.at(pos + 4, length * 2), length * 2, str);
+			pos += 4 + length * 2;
+			return str;
+		}
+	}
+
+	std::wstring CatalogCache::LessonGroupKey(const std::wstring& dirName, const std::wstring& lg_filename)
+	{
+		return dirName + L"/" + lg_filename;
+	}
+
+	bool CatalogCache::Load(const std::wstring& path)
+	{
+		this->languages.clear();
+		this->lessonGroups.clear();
+		Platform::MappedFile file{};
+		if (!file.Open(path)) return false;
+		try
+		{
+			const BlobReader reader(file.data(), file.size());
+			if (std::memcmp(reader.at(0, sizeof(Magic)), Magic, sizeof(Magic)) != 0) throw 7;
+			if (reader.read(4, 2) != Version) throw 8;
+			const size_t languageCount = static_cast<size_t>(reader.read(8, 4));
+			const size_t lessonGroupCount = static_cast<size_t>(reader.read(12, 4));
+			size_t pos = HeaderSize;
+			for (size_t lang = 0; lang < languageCount; lang++)
+			{
+				const std::wstring dirName = ReadString(reader, pos);
+				LanguageDirectory language{};
+				language.writeTime = reader.read(pos, 8);
+				const size_t count = static_cast<size_t>(reader.read(pos + 8, 4));
+				pos += 12;
+				for (size_t group = 0; group < count; group++) language.lessonGroupDirs.push_back(ReadString(reader, pos));
+				this->languages.emplace(dirName, std::move(language));
+			}
+			for (size_t group = 0; group < lessonGroupCount; group++)
+			{
+				const std::wstring key = ReadString(reader, pos);
+				LessonGroupDirectory lessonGroup{};
+				lessonGroup.writeTime = reader.read(pos, 8);
+				const size_t count = static_cast<size_t>(reader.read(pos + 8, 4));
+				pos += 12;
+				for (size_t lesson = 0; lesson < count; lesson++)
+				{
+					LessonFile lessonFile{};
+					lessonFile.filename = ReadString(reader, pos);
+					lessonFile.writeTime = reader.read(pos, 8);
+					lessonFile.titled = reader.read(pos + 8, 1) != 0;
+					pos += 9;
+					lessonFile.title = ReadString(reader, pos);
+					lessonGroup.lessons.push_back(std::move(lessonFile));
+				}
+				this->lessonGroups.emplace(key, std::move(lessonGroup));
+			}
+			return true;
+		}
+		catch (int)
+		{
+			this->languages.clear();
+			this->lessonGroups.clear();
+			return false;
+		}
+	}
+
+	bool CatalogCache::Save(const std::wstring& path) const
+	{
+		BlobWriter writer{};
+		for (const char c : Magic) writer.bytes.push_back(static_cast<unsigned char>(c));
+		writer.u16(Version);
+		writer.u16(0);
+		writer.u32(static_cast<std::uint32_t>(this->languages.size()));
+		writer.u32(static_cast<std::uint32_t>(this->lessonGroups.size()));
+		for (auto const & language : this->languages)
+		{
+			WriteString(writer, language.first);
+			writer.u64(language.second.writeTime);
+			writer.u32(static_cast<std::uint32_t>(language.second.lessonGroupDirs.size()));
+			for (auto const & lg_filename : language.second.lessonGroupDirs) WriteString(writer, lg_filename);
+		}
+		for (auto const & lessonGroup : this->lessonGroups)
+		{
+			WriteString(writer, lessonGroup.first);
+			writer.u64(lessonGroup.second.writeTime);
+			writer.u32(static_cast<std::uint32_t>(lessonGroup.second.lessons.size()));
+			for (auto const & lessonFile : lessonGroup.second.lessons)
+			{
+				WriteString(writer, lessonFile.filename);
+				writer.u64(lessonFile.writeTime);
+				writer.bytes.push_back(lessonFile.titled ? 1 : 0);
+				WriteString(writer, lessonFile.title);
+			}
+		}
+		return Platform::WriteBytes(path, writer.bytes.data(), writer.bytes.size(), Platform::WriteMode::TRUNCATE);
+	}
+}
@@ -0,0 +1,73 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef CATALOGCACHE_HPP
+#define CATALOGCACHE_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// Program headers
+#include "Platform.hpp"
+
+namespace ASP
+{
+	class CatalogCache // what the last LessonCatalog::Scan() found, with the write times it found it at, so the next one re-reads only what changed
+	{
+		// Layout, little-endian throughout:
+		//	header			"LCSC", u16 version, u16 reserved, u32 language count, u32 lesson group count
+		//	languages		str directory, u64 write time, u32 lesson group count, then str lesson group directory each
+		//	lesson groups	str "language directory/lesson group directory", u64 write time, u32 lesson count,
+		//					then str file name, u64 write time, u8 titled, str title each
+		// A str is a u32 length in UTF-16 code units, then UTF-16LE.
+		public:
+			static const std::uint16_t Version = 1;
+			static const std::wstring FileName; // catalog.bin
+			struct LessonFile
+			{
+				std::wstring filename = L"";
+				Platform::FileTime writeTime = 0;
+				bool titled = false; // false if the title couldn't be read, so it's tried again next time
+				std::wstring title = L"";
+			};
+			struct LanguageDirectory
+			{
+				Platform::FileTime writeTime = 0; // changes when a lesson group directory is added, removed or renamed
+				std::vector<std::wstring> lessonGroupDirs{}; // in the order they were listed
+			};
+			struct LessonGroupDirectory
+			{
+				Platform::FileTime writeTime = 0; // changes when a lesson file is added, removed or renamed
+				std::vector<LessonFile> lessons{}; // in the order they were listed
+			};
+			std::unordered_map<std::wstring, LanguageDirectory> languages{}; // (language directory, ...)
+			std::unordered_map<std::wstring, LessonGroupDirectory> lessonGroups{}; // (language directory/lesson group directory, ...)
+			static std::wstring LessonGroupKey(const std::wstring& dirName, const std::wstring& lg_filename);
+			bool Load(const std::wstring& path); // false, and empty, if there's no cache or it's unreadable
+			bool Save(const std::wstring& path) const;
+	};
+}
+
+#endif
@@ -0,0 +1,227 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <set>
+#include <memory> // std::make_unique
+#include <thread>
+#include <mutex>
+#include <utility> // std::swap, std::move
+#include <algorithm> // std::min
+
+// Project Headers
+#include "CatalogWatcher.hpp"
+#include "CourseArchive.hpp"
+#include "SyntaxGrammar.hpp"
+
+namespace ASP
+{
+	namespace
+	{
+		std::vector<std::wstring> SplitPath(const std::wstring& path) // Language/Lesson Group/File into its parts
+		{
+			std::vector<std::wstring> parts{};
+			size_t begin = 0;
+			while (begin <= path.size())
+			{
+				const size_t end = std::min(path.find(L'/', begin), path.size());
+				parts.push_back(path.substr(begin, end - begin));
+				begin = end + 1;
+			}
+			return parts;
+		}
+
+		bool Exists(const std::wstring& path) noexcept
+		{
+			Platform::FileTime writeTime = 0;
+			return Platform::GetLastWriteTime(path, writeTime);
+		}
+
+		Language* FindLanguage(LangList& langs, const std::wstring& dirName) // by its ###_Language directory
+		{
+			const size_t pos = dirName.find_first_of(L"_");
+			const auto found = langs.find(dirName.substr(0, pos));
+			if (found == langs.end() || pos == std::wstring::npos || found->second->name != dirName.substr(pos + 1)) return nullptr;
+			return found->second.get();
+		}
+	}
+
+	CatalogWatcher::CatalogWatcher(Notify _notify) : notify(std::move(_notify))
+	{
+	}
+
+	CatalogWatcher::~CatalogWatcher()
+	{
+		this->Stop();
+	}
+
+	bool CatalogWatcher::Start()
+	{
+		if (this->thread.joinable()) return true;
+		if (CourseArchive::IsOpen()) return false; // a packed course isn't edited in place
+		if (!this->watcher.Open(L"Languages")) return false;
+		this->thread = std::thread(&CatalogWatcher::Run, this);
+		return true;
+	}
+
+	void CatalogWatcher::Stop() noexcept
+	{
+		this->watcher.Cancel();
+		if (this->thread.joinable()) this->thread.join();
+		this->watcher.Close();
+	}
+
+	void CatalogWatcher::Run() // the watcher's thread
+	{
+		std::vector<std::wstring> paths{};
+		while (this->watcher.Wait(paths))
+		{
+			size_t seen = 0;
+			do
+			{
+				seen = paths.size();
+				if (!this->watcher.Wait(paths, SettleMilliseconds)) return;
+			} while (paths.size() != seen);
+			if (this->Record(paths) && this->notify) this->notify();
+			paths.clear();
+		}
+	}
+
+	bool CatalogWatcher::Record(const std::vector<std::wstring>& paths) // sorts the changed paths into what Apply() has to reread
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		bool recorded = false;
+		for (const std::wstring& path : paths)
+		{
+			const std::vector<std::wstring> parts = SplitPath(path);
+			if (path.empty()) this->everything = true;
+			else if (parts.size() == 1) this->languages = true;
+			else if (parts.size() == 2 && parts[1] == LessonCatalog::ReservedLessonFileNames[0]) this->grammars.insert(parts[0]);
+			else if (parts.size() == 2 && LessonCatalog::IsLessonGroupDirName(parts[1])) this->languageDirs.insert(parts[0]);
+			else if (parts.size() == 3 && LessonCatalog::IsLessonGroupDirName(parts[1]) && LessonCatalog::IsLessonFileName(parts[2])) this->lessonGroupDirs.insert(parts[0] + L"/" + parts[1]);
+			else continue; // CHECKER.dll, compiled lessons and the like aren't in the catalog
+			recorded = true;
+		}
+		return recorded;
+	}
+
+	bool CatalogWatcher::Apply(LangList* langs)
+	{
+		if (langs == nullptr) return false;
+		bool rescanEverything = false;
+		bool rescanLanguages = false;
+		std::set<std::wstring> changedLanguageDirs{};
+		std::set<std::wstring> changedLessonGroupDirs{};
+		std::set<std::wstring> changedGrammars{};
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			std::swap(rescanEverything, this->everything);
+			std::swap(rescanLanguages, this->languages);
+			std::swap(changedLanguageDirs, this->languageDirs);
+			std::swap(changedLessonGroupDirs, this->lessonGroupDirs);
+			std::swap(changedGrammars, this->grammars);
+		}
+		for (const std::wstring& dirName : changedGrammars) SyntaxGrammar::Forget(dirName);
+		if (rescanEverything)
+		{
+			langs->clear();
+			LessonCatalog::Scan(langs); // the CatalogCache still spares it the lessons that didn't change
+			return true;
+		}
+		bool changed = false;
+		std::set<std::wstring> freshDirs{}; // read whole just now, so the changes under them are already in
+
+		// languages added, removed or renamed
+		std::vector<Platform::DirectoryEntry> entries{};
+		if (rescanLanguages && Platform::ListDirectory(L"Languages", entries))
+		{
+			std::set<std::wstring> dirNames{};
+			for (const Platform::DirectoryEntry& entry : entries) dirNames.insert(entry.name);
+			for (auto lang = langs->begin(); lang != langs->end();)
+			{
+				if (dirNames.count(lang->first + L"_" + lang->second->name) != 0) ++lang;
+				else
+				{
+					lang = langs->erase(lang);
+					changed = true;
+				}
+			}
+			for (const std::wstring& dirName : dirNames)
+			{
+				Language language{};
+				if (FindLanguage(*langs, dirName) != nullptr || !LessonCatalog::ScanLanguage(dirName, language)) continue;
+				if (!langs->emplace(language.langID, std::make_unique<Language>(language.name, language.langID, language.lessonGroups)).second) continue;
+				freshDirs.insert(dirName);
+				changed = true;
+			}
+		}
+
+		// lesson groups added, removed or renamed
+		for (const std::wstring& dirName : changedLanguageDirs)
+		{
+			Language* language = FindLanguage(*langs, dirName);
+			if (language == nullptr || freshDirs.count(dirName) != 0 || !Platform::ListDirectory(L"Languages/" + dirName, entries)) continue;
+			std::set<std::wstring> lessonGroupDirNames{};
+			for (const Platform::DirectoryEntry& entry : entries) if (LessonCatalog::IsLessonGroupDirName(entry.name)) lessonGroupDirNames.insert(entry.name);
+			for (auto lessonGroup = language->lessonGroups.begin(); lessonGroup != language->lessonGroups.end();)
+			{
+				if (lessonGroupDirNames.count(lessonGroup->first + L" " + lessonGroup->second.name) != 0) ++lessonGroup;
+				else
+				{
+					lessonGroup = language->lessonGroups.erase(lessonGroup);
+					changed = true;
+				}
+			}
+			for (const std::wstring& lg_filename : lessonGroupDirNames)
+			{
+				const size_t spaceFoundPos = lg_filename.find(L' ');
+				if (language->lessonGroups.count(lg_filename.substr(0, spaceFoundPos)) != 0) continue;
+				std::wstring lgID = L"";
+				LessonGroup lessonGroup{};
+				if (!LessonCatalog::ScanLessonGroup(dirName, lg_filename, lgID, lessonGroup)) continue;
+				language->lessonGroups.emplace(lgID, std::move(lessonGroup));
+				freshDirs.insert(dirName + L"/" + lg_filename);
+				changed = true;
+			}
+		}
+
+		// lessons added, removed, renamed or retitled
+		for (const std::wstring& key : changedLessonGroupDirs)
+		{
+			const size_t slashPos = key.find(L'/');
+			const std::wstring dirName = key.substr(0, slashPos);
+			const std::wstring lg_filename = key.substr(slashPos + 1);
+			Language* language = FindLanguage(*langs, dirName);
+			if (language == nullptr || freshDirs.count(dirName) != 0 || freshDirs.count(key) != 0) continue;
+			const size_t spaceFoundPos = lg_filename.find(L' ');
+			const auto found = language->lessonGroups.find(lg_filename.substr(0, spaceFoundPos));
+			if (found == language->lessonGroups.end() || found->second.name != lg_filename.substr(spaceFoundPos + 1)) continue; // gone, and its language directory's change took it out
+			std::wstring lgID = L"";
+			LessonGroup lessonGroup{};
+			if (!Exists(L"Languages/" + key)) continue; // going, and the change that takes it out is still to come
+			if (!LessonCatalog::ScanLessonGroup(dirName, lg_filename, lgID, lessonGroup) || lessonGroup.lessons == found->second.lessons) continue; // an edit that left the titles alone
+			found->second = std::move(lessonGroup);
+			changed = true;
+		}
+		return changed;
+	}
+}
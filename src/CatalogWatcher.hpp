@@ -0,0 +1,68 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef CATALOGWATCHER_HPP
+#define CATALOGWATCHER_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <set>
+#include <functional> // std::function
+#include <thread>
+#include <mutex>
+
+// Program headers
+#include "LessonCatalog.hpp"
+#include "Platform.hpp"
+
+namespace ASP
+{
+	class CatalogWatcher // watches Languages/ while the app runs, and brings a LangList up to date with what authors add, remove, rename and edit
+	{
+		public:
+			using Notify = std::function<void(void)>; // called on the watcher's thread when there's something to Apply(); it should only hand that to the LangList's thread
+			static const int SettleMilliseconds = 100; // an editor's save is several changes; they're gathered until none come for this long
+		private:
+			Platform::DirectoryWatcher watcher{};
+			std::thread thread;
+			Notify notify;
+			std::mutex mutex;
+			bool everything = false; // too much changed to say what
+			bool languages = false; // Languages/ itself
+			std::set<std::wstring> languageDirs{}; // whose lesson group directories changed
+			std::set<std::wstring> lessonGroupDirs{}; // language directory/lesson group directory, whose lessons changed
+			std::set<std::wstring> grammars{}; // language directories whose SYNTAX.txt changed
+			void Run(void);
+			bool Record(const std::vector<std::wstring>& paths);
+		public:
+			explicit CatalogWatcher(Notify _notify);
+			CatalogWatcher(const CatalogWatcher&) = delete;
+			CatalogWatcher& operator=(const CatalogWatcher&) = delete;
+			~CatalogWatcher();
+			bool Start(void);
+			void Stop(void) noexcept;
+			bool Apply(LangList* langs); // on the LangList's thread: true if it changed
+	};
+}
+
+#endif
@@ -1,130 +1,333 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-// STL headers
-#include <vector>
-
-// program headers
-#include "CodeChecker.hpp"
-#include "misc.hpp"
-#include "gui.hpp"
-
-namespace ASP
-{
-	CodeChecker::CodeChecker(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _code) noexcept : language(_language), langID(_langID), code(_code)
-	{
-		// load the CHECKER.dll
-		const std::wstring dllPath = L"C:\\Users\\Daryl_2017\\Desktop\\Dev\\ACA\\src\\Languages\\" + _langID + L"_" + _language + L"\\" + GUI::ReservedLessonFileNames[1];
-		this->hDLL = LoadLibrary(dllPath.c_str());
-		if (!this->hDLL)
-		{
-			this->errorState = CodeChecker::Error::LOADLIBRARY;
-			ErrorExit();
-		}
-	}
-
-	CodeChecker::~CodeChecker() noexcept
-	{
-		FreeLibrary(this->hDLL);
-	}
-
-	void CodeChecker::Init()
-	{
-		if (this->errorState != CodeChecker::Error::ALLGOOD) return;
-		size_t* respBufSizePtr = reinterpret_cast<size_t*>(GetProcAddress(this->hDLL, "respBufSize"));
-		if (!respBufSizePtr)
-		{
-			this->errorState = CodeChecker::Error::GETRESPBUFSIZE;
-			return;
-		}
-		this->respBufSize = *respBufSizePtr;
-		this->IdentifyPtr = reinterpret_cast<CodeChecker::LibFunctionIdentify>(GetProcAddress(this->hDLL, "Identify"));
-		if (!this->IdentifyPtr)
-		{
-			this->errorState = CodeChecker::Error::GETIDENTIFY;
-			return;
-		}
-		this->CheckSyntaxPtr = reinterpret_cast<CodeChecker::LibFunctionCheckSyntax>(GetProcAddress(this->hDLL, "CheckSyntax"));
-		if (!this->CheckSyntaxPtr)
-		{
-			this->errorState = CodeChecker::Error::GETCHECKSYNTAX;
-			return;
-		}
-		this->QueryPtr = reinterpret_cast<CodeChecker::LibFunctionQuery>(GetProcAddress(this->hDLL, "Query"));
-		if (!this->QueryPtr)
-		{
-			this->errorState = CodeChecker::Error::GETQUERY;
-			return;
-		}
-	}
-
-	size_t CodeChecker::getRespBufSize() const noexcept
-	{
-		if (this->errorState != CodeChecker::Error::GETRESPBUFSIZE) return this->respBufSize;
-		else return 0;
-	}
-
-	CodeChecker::Error CodeChecker::getErrorState() const noexcept
-	{
-		return this->errorState;
-	}
-
-	std::wstring CodeChecker::Identify()
-	{
-		if (this->errorState != CodeChecker::Error::ALLGOOD) return this->errStr;
-		std::vector<wchar_t> buffer(this->respBufSize + 1, 0);
-		this->IdentifyPtr(&buffer[0], buffer.size());
-		if (buffer[0] == L'\0')
-		{
-			if(buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
-			else this->errorState = CodeChecker::Error::IDENTIFY;
-			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
-		}
-		return std::wstring(&buffer[0]);
-	}
-
-	std::wstring CodeChecker::CheckSyntax()
-	{
-		if (errorState != CodeChecker::Error::ALLGOOD) return this->errStr;
-		std::vector<wchar_t> buffer(this->respBufSize + 1, 0);
-		this->CheckSyntaxPtr(this->code.c_str(), &buffer[0], buffer.size() - 1);
-		if (buffer.at(0) == L'\0')
-		{
-			if (buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
-			else this->errorState = CodeChecker::Error::CHECKSYNTAX;
-			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
-		}
-		return std::wstring(&buffer[0]);
-	}
-
-	std::wstring CodeChecker::Query(const std::wstring& command)
-	{
-		if (errorState == CodeChecker::Error::GETQUERY) return this->errStr;
-		std::vector<wchar_t> buffer(this->respBufSize + 1, 0);
-		this->QueryPtr(this->code.c_str(), command.c_str(), &buffer[0], buffer.size());
-		if (buffer[0] == L'\0')
-		{
-			if (buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
-			else this->errorState = CodeChecker::Error::QUERY;
-			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
-		}
-		return std::wstring(&buffer[0]);
-	}
-}
\ No newline at end of file
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL headers
+#include <string>
+#include <vector>
+#include <memory> // std::make_shared
+#include <mutex>
+#include <cstdlib> // _wdupenv_s, free
+#include <utility> // std::move
+
+// program headers
+#include "CodeChecker.hpp"
+#include "misc.hpp"
+#include "LessonCatalog.hpp"
+
+namespace ASP
+{
+	namespace
+	{
+		std::vector<std::wstring> DefaultSearchPath() // LEARNCS_CHECKER_PATH, ;-separated, then Languages/ next to the app
+		{
+			std::vector<std::wstring> directories{};
+			wchar_t* variable = nullptr;
+			size_t length = 0;
+			if (_wdupenv_s(&variable, &length, L"LEARNCS_CHECKER_PATH") == 0 && variable != nullptr)
+			{
+				const std::wstring value = variable;
+				free(variable);
+				size_t begin = 0;
+				while (begin <= value.size())
+				{
+					const size_t end = (value.find(L';', begin) == std::wstring::npos) ? value.size() : value.find(L';', begin);
+					if (end > begin) directories.push_back(value.substr(begin, end - begin));
+					begin = end + 1;
+				}
+			}
+			directories.push_back(L"Languages");
+			return directories;
+		}
+
+		template <typename Char, typename RunAll, typename Decode>
+		bool ReadResults(const size_t checkCount, const size_t charsPerCheckGuess, RunAll runAll, Decode decode, std::vector<CodeChecker::Result>& results) // one record per check, then the failures' messages; the DLL says how big that is when the first guess is too small
+		{
+			using WireResult = CodeChecker::CheckerModule::WireResult;
+			const size_t recordBytes = checkCount * sizeof(WireResult);
+			std::vector<std::uint32_t> buffer((recordBytes + checkCount * charsPerCheckGuess * sizeof(Char) + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t)); // uint32_t keeps the records aligned
+			size_t requiredSize = runAll(buffer.data(), buffer.size() * sizeof(std::uint32_t));
+			if (requiredSize > buffer.size() * sizeof(std::uint32_t))
+			{
+				buffer.resize((requiredSize + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t));
+				requiredSize = runAll(buffer.data(), buffer.size() * sizeof(std::uint32_t)); // only copies - the session kept the results
+			}
+			if (requiredSize < recordBytes || requiredSize > buffer.size() * sizeof(std::uint32_t) || (requiredSize - recordBytes) % sizeof(Char) != 0) return false;
+			const WireResult* records = reinterpret_cast<const WireResult*>(buffer.data());
+			const Char* text = reinterpret_cast<const Char*>(reinterpret_cast<const char*>(buffer.data()) + recordBytes);
+			const size_t textLength = (requiredSize - recordBytes) / sizeof(Char);
+			results.reserve(checkCount);
+			for (size_t i = 0; i < checkCount; i++)
+			{
+				if (records[i].offset > textLength || records[i].length > textLength - records[i].offset)
+				{
+					results.clear();
+					return false;
+				}
+				results.push_back(CodeChecker::Result{ static_cast<CodeChecker::Outcome>(records[i].outcome), decode(text + records[i].offset, records[i].length) });
+			}
+			return true;
+		}
+	}
+
+	std::mutex CodeChecker::CheckerModule::registryMutex;
+
+	std::unordered_map<std::wstring, CodeChecker::CheckerModule::RegistryEntry> CodeChecker::CheckerModule::registry;
+
+	std::vector<std::wstring> CodeChecker::CheckerModule::searchPath = DefaultSearchPath();
+
+	CodeChecker::CheckerModule::CheckerModule(const std::wstring& dllPath)
+	{
+		this->hDLL = LoadLibrary(dllPath.c_str());
+		if (!this->hDLL)
+		{
+			this->loadError = CodeChecker::Error::LOADLIBRARY;
+			return;
+		}
+		const size_t* respBufSizePtr = reinterpret_cast<const size_t*>(GetProcAddress(this->hDLL, "respBufSize"));
+		if (!respBufSizePtr)
+		{
+			this->loadError = CodeChecker::Error::GETRESPBUFSIZE;
+			return;
+		}
+		this->respBufSize = *respBufSizePtr;
+		this->IdentifyPtr = reinterpret_cast<LibFunctionIdentify>(GetProcAddress(this->hDLL, "Identify"));
+		if (!this->IdentifyPtr)
+		{
+			this->loadError = CodeChecker::Error::GETIDENTIFY;
+			return;
+		}
+		this->CheckSyntaxPtr = reinterpret_cast<LibFunctionCheckSyntax>(GetProcAddress(this->hDLL, "CheckSyntax"));
+		if (!this->CheckSyntaxPtr)
+		{
+			this->loadError = CodeChecker::Error::GETCHECKSYNTAX;
+			return;
+		}
+		this->QueryPtr = reinterpret_cast<LibFunctionQuery>(GetProcAddress(this->hDLL, "Query"));
+		if (!this->QueryPtr)
+		{
+			this->loadError = CodeChecker::Error::GETQUERY;
+			return;
+		}
+		this->OpenSessionPtr = reinterpret_cast<LibFunctionOpenSession>(GetProcAddress(this->hDLL, "OpenSession"));
+		this->SessionCheckSyntaxPtr = reinterpret_cast<LibFunctionSessionCheckSyntax>(GetProcAddress(this->hDLL, "SessionCheckSyntax"));
+		this->SessionQueryPtr = reinterpret_cast<LibFunctionSessionQuery>(GetProcAddress(this->hDLL, "SessionQuery"));
+		this->CloseSessionPtr = reinterpret_cast<LibFunctionCloseSession>(GetProcAddress(this->hDLL, "CloseSession"));
+		this->SessionRunAllPtr = reinterpret_cast<LibFunctionSessionRunAll>(GetProcAddress(this->hDLL, "SessionRunAll"));
+		this->OpenSessionUTF8Ptr = reinterpret_cast<LibFunctionOpenSessionUTF8>(GetProcAddress(this->hDLL, "OpenSessionUTF8"));
+		this->SessionRunAllUTF8Ptr = reinterpret_cast<LibFunctionSessionRunAllUTF8>(GetProcAddress(this->hDLL, "SessionRunAllUTF8"));
+	}
+
+	bool CodeChecker::CheckerModule::HasSessions() const noexcept
+	{
+		return this->OpenSessionPtr && this->SessionCheckSyntaxPtr && this->SessionQueryPtr && this->CloseSessionPtr;
+	}
+
+	CodeChecker::CheckerModule::~CheckerModule() noexcept
+	{
+		if (this->hDLL) FreeLibrary(this->hDLL);
+	}
+
+	std::shared_ptr<const CodeChecker::CheckerModule> CodeChecker::CheckerModule::Get(const std::wstring& language, const std::wstring& langID)
+	{
+		const std::wstring dirName = langID + L"_" + language;
+		std::lock_guard<std::mutex> lock(registryMutex);
+		for (const std::wstring& directory : searchPath)
+		{
+			const std::wstring dllPath = directory + L"/" + dirName + L"/" + LessonCatalog::ReservedLessonFileNames[1];
+			Platform::FileTime lastWriteTime = 0;
+			if (!Platform::GetLastWriteTime(dllPath, lastWriteTime)) continue; // not in this directory
+
+			// LoadLibrary hands back the module already loaded from a path rather than reading the file again, so a
+			// CHECKER.dll rebuilt in place is only picked up by a restart; only a change of search path loads another one
+			auto found = registry.find(dirName);
+			if (found != registry.end() && found->second.path == dllPath) return found->second.module;
+			std::shared_ptr<const CheckerModule> module = std::make_shared<const CheckerModule>(dllPath);
+			if (module->loadError == CodeChecker::Error::LOADLIBRARY) return nullptr;
+			registry[dirName] = RegistryEntry{ dllPath, module };
+			return module;
+		}
+		return nullptr;
+	}
+
+	void CodeChecker::CheckerModule::SetSearchPath(const std::vector<std::wstring>& directories)
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		searchPath = directories;
+	}
+
+	std::vector<std::wstring> CodeChecker::CheckerModule::GetSearchPath()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		return searchPath;
+	}
+
+	CodeChecker::CodeChecker(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _code) : language(_language), langID(_langID), code(_code)
+	{
+		this->module = CheckerModule::Get(_language, _langID); // loaded by the first check only
+		if (!this->module) this->errorState = CodeChecker::Error::LOADLIBRARY;
+	}
+
+	CodeChecker::CodeChecker(const std::wstring& _language, const std::wstring& _langID, std::string _codeUTF8) : language(_language), langID(_langID), codeUTF8(std::move(_codeUTF8))
+	{
+		this->module = CheckerModule::Get(_language, _langID);
+		if (!this->module) this->errorState = CodeChecker::Error::LOADLIBRARY;
+	}
+
+	CodeChecker::~CodeChecker() noexcept
+	{
+		if (this->session) this->module->CloseSessionPtr(this->session);
+	}
+
+	const std::wstring& CodeChecker::getCode()
+	{
+		if (this->code.empty() && !this->codeUTF8.empty()) this->code = utf8_decode(this->codeUTF8);
+		return this->code;
+	}
+
+	const std::string& CodeChecker::getCodeUTF8()
+	{
+		if (this->codeUTF8.empty() && !this->code.empty()) this->codeUTF8 = utf8_encode(this->code);
+		return this->codeUTF8;
+	}
+
+	void* CodeChecker::getSession()
+	{
+		if (this->session || !this->module->HasSessions()) return this->session;
+		if (this->module->OpenSessionUTF8Ptr) this->session = this->module->OpenSessionUTF8Ptr(this->getCodeUTF8().data(), this->getCodeUTF8().length());
+		else this->session = this->module->OpenSessionPtr(this->getCode().c_str()); // stays nullptr if the DLL couldn't open one, and the plain functions are used
+		return this->session;
+	}
+
+	void CodeChecker::Init() // the entry points were looked up when the module was loaded
+	{
+		if (this->errorState != CodeChecker::Error::ALLGOOD) return;
+		this->errorState = this->module->loadError;
+	}
+
+	size_t CodeChecker::getRespBufSize() const noexcept
+	{
+		if (this->module && this->errorState != CodeChecker::Error::GETRESPBUFSIZE) return this->module->respBufSize;
+		else return 0;
+	}
+
+	CodeChecker::Error CodeChecker::getErrorState() const noexcept
+	{
+		return this->errorState;
+	}
+
+	std::wstring CodeChecker::Identify()
+	{
+		if (this->errorState != CodeChecker::Error::ALLGOOD) return this->errStr;
+		std::vector<wchar_t> buffer(this->module->respBufSize + 1, 0);
+		this->module->IdentifyPtr(&buffer[0], buffer.size());
+		if (buffer[0] == L'\0')
+		{
+			if(buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
+			else this->errorState = CodeChecker::Error::IDENTIFY;
+			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
+		}
+		return std::wstring(&buffer[0]);
+	}
+
+	std::wstring CodeChecker::CheckSyntax()
+	{
+		if (errorState != CodeChecker::Error::ALLGOOD) return this->errStr;
+		std::vector<wchar_t> buffer(this->module->respBufSize + 1, 0);
+		void* parsed = this->getSession();
+		if (parsed) this->module->SessionCheckSyntaxPtr(parsed, &buffer[0], buffer.size() - 1);
+		else this->module->CheckSyntaxPtr(this->getCode().c_str(), &buffer[0], buffer.size() - 1);
+		if (buffer.at(0) == L'\0')
+		{
+			if (buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
+			else this->errorState = CodeChecker::Error::CHECKSYNTAX;
+			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
+		}
+		return std::wstring(&buffer[0]);
+	}
+
+	std::wstring CodeChecker::Query(const std::wstring& command)
+	{
+		if (errorState != CodeChecker::Error::ALLGOOD) return this->errStr;
+		std::vector<wchar_t> buffer(this->module->respBufSize + 1, 0);
+		void* parsed = this->getSession();
+		if (parsed) this->module->SessionQueryPtr(parsed, command.c_str(), &buffer[0], buffer.size());
+		else this->module->QueryPtr(this->getCode().c_str(), command.c_str(), &buffer[0], buffer.size());
+		if (buffer[0] == L'\0')
+		{
+			if (buffer[1] == EINVAL || buffer[1] == ERANGE || buffer[1] == STRUNCATE) this->errorState = CodeChecker::Error::STRINGERROR;
+			else this->errorState = CodeChecker::Error::QUERY;
+			return this->errStr + L" - !" + std::to_wstring(buffer[1]) + L"!";
+		}
+		return std::wstring(&buffer[0]);
+	}
+
+	std::vector<CodeChecker::Result> CodeChecker::RunAll(const std::vector<std::wstring>& queries)
+	{
+		std::vector<CodeChecker::Result> results{};
+		if (this->errorState != CodeChecker::Error::ALLGOOD) return results;
+		void* parsed = (this->module->SessionRunAllPtr || this->module->SessionRunAllUTF8Ptr) ? this->getSession() : nullptr;
+		if (!parsed) // the CHECKER.dll answers one check per call
+		{
+			const auto toResult = [](const std::wstring& response)
+			{
+				if (response == L"SUCCESS") return CodeChecker::Result{};
+				return CodeChecker::Result{ CodeChecker::Outcome::FAILED, response };
+			};
+			const std::wstring syntaxResponse = this->CheckSyntax();
+			if (this->errorState != CodeChecker::Error::ALLGOOD) return results;
+			results.push_back(toResult(syntaxResponse));
+			for (const std::wstring& query : queries)
+			{
+				const std::wstring queryResponse = this->Query(query);
+				if (this->errorState != CodeChecker::Error::ALLGOOD) break;
+				results.push_back(toResult(queryResponse));
+			}
+			return results;
+		}
+
+		const size_t checkCount = queries.size() + 1;
+		if (this->module->SessionRunAllUTF8Ptr) // answered in UTF-8; only the failures' messages are converted, for display
+		{
+			std::vector<std::string> queriesUTF8{};
+			std::vector<const char*> queryStrings{};
+			std::vector<size_t> queryLengths{};
+			queriesUTF8.reserve(queries.size());
+			for (const std::wstring& query : queries) queriesUTF8.push_back(utf8_encode(query));
+			for (const std::string& query : queriesUTF8)
+			{
+				queryStrings.push_back(query.data());
+				queryLengths.push_back(query.length());
+			}
+			const auto runAll = [&](void* resultBuf, const size_t resultBufSize) { return this->module->SessionRunAllUTF8Ptr(parsed, queryStrings.data(), queryLengths.data(), queryStrings.size(), resultBuf, resultBufSize); };
+			const auto decode = [](const char* text, const size_t length) { return utf8_decode(std::string(text, length)); };
+			if (!ReadResults<char>(checkCount, this->module->respBufSize, runAll, decode, results)) this->errorState = CodeChecker::Error::QUERY;
+		}
+		else
+		{
+			std::vector<const wchar_t*> queryStrings{};
+			queryStrings.reserve(queries.size());
+			for (const std::wstring& query : queries) queryStrings.push_back(query.c_str());
+			const auto runAll = [&](void* resultBuf, const size_t resultBufSize) { return this->module->SessionRunAllPtr(parsed, queryStrings.data(), queryStrings.size(), resultBuf, resultBufSize); };
+			const auto decode = [](const wchar_t* text, const size_t length) { return std::wstring(text, length); };
+			if (!ReadResults<wchar_t>(checkCount, this->module->respBufSize, runAll, decode, results)) this->errorState = CodeChecker::Error::QUERY;
+		}
+		return results;
+	}
+}
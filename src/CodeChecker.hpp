@@ -1,77 +1,149 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-#pragma once
-
-#ifndef CODECHECKER_HPP
-#define CODECHECKER_HPP
-
-// STL headers
-#include <string>
-
-// Windows headers
-#define UNICODE
-#include <windows.h>
-
-namespace ASP
-{
-	class CodeChecker
-	{
-		public:
-			enum class Error : unsigned int
-			{
-				ALLGOOD = 0,
-				LOADLIBRARY = 1,
-				GETRESPBUFSIZE = 2,
-				GETIDENTIFY = 3,
-				GETCHECKSYNTAX = 4,
-				GETQUERY = 5,
-				STRINGERROR = 6,
-				IDENTIFY = 7,
-				CHECKSYNTAX = 8,
-				QUERY = 9,
-			};
-		private:
-			std::wstring language = L"";
-			std::wstring langID = L"";
-			std::wstring code = L"";
-			HINSTANCE hDLL = nullptr;
-			size_t respBufSize = 0;
-			CodeChecker::Error errorState = CodeChecker::Error::ALLGOOD;
-			const std::wstring errStr = L"!ERROR!";
-			using LibFunctionIdentify = void(*)(wchar_t*, const size_t);
-			using LibFunctionCheckSyntax = void (*)(const wchar_t*, wchar_t*, const size_t);
-			using LibFunctionQuery = void(*)(const wchar_t*, const wchar_t*, wchar_t*, const size_t);
-			LibFunctionIdentify IdentifyPtr = nullptr;
-			LibFunctionCheckSyntax CheckSyntaxPtr = nullptr;
-			LibFunctionQuery QueryPtr = nullptr;
-		public:
-			CodeChecker(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _code) noexcept;
-			void Init(void);
-			size_t getRespBufSize(void) const noexcept;
-			CodeChecker::Error getErrorState(void) const noexcept;
-			std::wstring Identify(void);
-			std::wstring CheckSyntax(void);
-			std::wstring Query(const std::wstring& command);
-			~CodeChecker(void) noexcept;
-	};
-}
-
-#endif
\ No newline at end of file
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef CODECHECKER_HPP
+#define CODECHECKER_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <memory> // std::shared_ptr
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+
+// Windows headers
+#define UNICODE
+#include <windows.h>
+
+// Program headers
+#include "Platform.hpp"
+
+namespace ASP
+{
+	class CodeChecker // one check of the code in an SCBOX, through its language's CheckerModule
+	{
+		public:
+			enum class Error : unsigned int
+			{
+				ALLGOOD = 0,
+				LOADLIBRARY = 1,
+				GETRESPBUFSIZE = 2,
+				GETIDENTIFY = 3,
+				GETCHECKSYNTAX = 4,
+				GETQUERY = 5,
+				STRINGERROR = 6,
+				IDENTIFY = 7,
+				CHECKSYNTAX = 8,
+				QUERY = 9,
+			};
+			enum class Outcome : std::uint32_t
+			{
+				PASSED = 0,
+				FAILED = 1,
+				UNSUPPORTED = 2, // the CHECKER.dll doesn't know the query
+			};
+			struct Result // RunAll's answer to one check
+			{
+				CodeChecker::Outcome outcome = CodeChecker::Outcome::PASSED;
+				std::wstring message = L""; // empty when it passed
+			};
+			class CheckerModule // a language's CHECKER.dll, loaded and its entry points looked up once, then shared by every check
+			{
+				public:
+					using LibFunctionIdentify = void(*)(wchar_t*, const size_t);
+					using LibFunctionCheckSyntax = void (*)(const wchar_t*, wchar_t*, const size_t);
+					using LibFunctionQuery = void(*)(const wchar_t*, const wchar_t*, wchar_t*, const size_t);
+					using LibFunctionOpenSession = void*(*)(const wchar_t*);
+					using LibFunctionSessionCheckSyntax = void(*)(void*, wchar_t*, const size_t);
+					using LibFunctionSessionQuery = void(*)(void*, const wchar_t*, wchar_t*, const size_t);
+					using LibFunctionCloseSession = void(*)(void*);
+					using LibFunctionSessionRunAll = size_t(*)(void*, const wchar_t* const*, const size_t, void*, const size_t);
+					using LibFunctionOpenSessionUTF8 = void*(*)(const char*, const size_t);
+					using LibFunctionSessionRunAllUTF8 = size_t(*)(void*, const char* const*, const size_t*, const size_t, void*, const size_t);
+					struct WireResult // laid out as CheckerResult in the CHECKER.dlls
+					{
+						std::uint32_t outcome = 0;
+						std::uint32_t offset = 0;
+						std::uint32_t length = 0;
+					};
+				private:
+					struct RegistryEntry
+					{
+						std::wstring path = L"";
+						std::shared_ptr<const CheckerModule> module{};
+					};
+					static std::mutex registryMutex;
+					static std::unordered_map<std::wstring, RegistryEntry> registry; // (langID_language, entry)
+					static std::vector<std::wstring> searchPath;
+					HMODULE hDLL = nullptr;
+				public:
+					CodeChecker::Error loadError = CodeChecker::Error::ALLGOOD; // the first entry point that couldn't be found, if any
+					size_t respBufSize = 0;
+					LibFunctionIdentify IdentifyPtr = nullptr;
+					LibFunctionCheckSyntax CheckSyntaxPtr = nullptr;
+					LibFunctionQuery QueryPtr = nullptr;
+					LibFunctionOpenSession OpenSessionPtr = nullptr; // the session functions are optional - a CHECKER.dll without them re-parses the code on every call
+					LibFunctionSessionCheckSyntax SessionCheckSyntaxPtr = nullptr;
+					LibFunctionSessionQuery SessionQueryPtr = nullptr;
+					LibFunctionCloseSession CloseSessionPtr = nullptr;
+					LibFunctionSessionRunAll SessionRunAllPtr = nullptr; // optional too
+					LibFunctionOpenSessionUTF8 OpenSessionUTF8Ptr = nullptr; // optional, and used over their UTF-16 versions when there
+					LibFunctionSessionRunAllUTF8 SessionRunAllUTF8Ptr = nullptr;
+					bool HasSessions(void) const noexcept;
+					explicit CheckerModule(const std::wstring& dllPath);
+					CheckerModule(const CheckerModule&) = delete;
+					CheckerModule& operator=(const CheckerModule&) = delete;
+					~CheckerModule() noexcept;
+					static std::shared_ptr<const CheckerModule> Get(const std::wstring& language, const std::wstring& langID); // nullptr if there's no CHECKER.dll or it won't load; loaded once per run, so a rebuilt one needs a restart
+					static void SetSearchPath(const std::vector<std::wstring>& directories); // where ###_Language/CHECKER.dll is looked for, first match wins
+					static std::vector<std::wstring> GetSearchPath(void);
+			};
+		private:
+			std::wstring language = L"";
+			std::wstring langID = L"";
+			std::wstring code = L""; // whichever of code and codeUTF8 wasn't given is converted only if a CHECKER.dll function needs it
+			std::string codeUTF8 = "";
+			std::shared_ptr<const CheckerModule> module{};
+			void* session = nullptr; // the code as parsed by the CHECKER.dll, opened by the first CheckSyntax or Query
+			CodeChecker::Error errorState = CodeChecker::Error::ALLGOOD;
+			const std::wstring errStr = L"!ERROR!";
+			const std::wstring& getCode(void);
+			const std::string& getCodeUTF8(void);
+			void* getSession(void);
+		public:
+			CodeChecker(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _code);
+			CodeChecker(const std::wstring& _language, const std::wstring& _langID, std::string _codeUTF8);
+			CodeChecker(const CodeChecker&) = delete;
+			CodeChecker& operator=(const CodeChecker&) = delete;
+			~CodeChecker() noexcept;
+			void Init(void);
+			size_t getRespBufSize(void) const noexcept;
+			CodeChecker::Error getErrorState(void) const noexcept;
+			std::wstring Identify(void);
+			std::wstring CheckSyntax(void);
+			std::wstring Query(const std::wstring& command);
+			std::vector<CodeChecker::Result> RunAll(const std::vector<std::wstring>& queries); // the syntax check, then every query, in one call into the CHECKER.dll when it can
+	};
+}
+
+#endif
@@ -0,0 +1,288 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <map>
+#include <memory> // std::make_unique
+#include <mutex>
+#include <cstdint>
+#include <cstring> // std::memcmp
+#include <algorithm> // std::sort
+#include <limits>
+
+// Project Headers
+#include "CourseArchive.hpp"
+#include "BinaryIO.hpp"
+
+namespace ASP
+{
+	const std::wstring CourseArchive::FileName = L"Course.lcpak";
+
+	std::mutex CourseArchive::archiveMutex;
+
+	Platform::MappedFile CourseArchive::archive;
+
+	bool CourseArchive::opened = false;
+
+	namespace
+	{
+		const char Magic[4] = { 'L', 'C', 'S', 'A' };
+		const size_t HeaderSize = 32;
+		const size_t LanguageEntrySize = 16;
+		const size_t LessonGroupEntrySize = 16;
+		const size_t LessonEntrySize = 20;
+
+		struct Index // where the tables start
+		{
+			size_t languageCount = 0;
+			size_t lessonGroupCount = 0;
+			size_t lessonCount = 0;
+			size_t languages = 0;
+			size_t lessonGroups = 0;
+			size_t lessons = 0;
+			size_t strings = 0;
+			size_t contents = 0;
+		};
+
+		Index ReadIndex(const BlobReader& reader)
+		{
+			if (std::memcmp(reader.at(0, sizeof(Magic)), Magic, sizeof(Magic)) != 0) throw 7;
+			if (reader.read(4, 2) != CourseArchive::Version) throw 8;
+			Index index{};
+			index.languageCount = static_cast<size_t>(reader.read(8, 4));
+			index.lessonGroupCount = static_cast<size_t>(reader.read(12, 4));
+			index.lessonCount = static_cast<size_t>(reader.read(16, 4));
+			index.strings = static_cast<size_t>(reader.read(20, 4));
+			index.contents = static_cast<size_t>(reader.read(24, 8));
+			index.languages = HeaderSize;
+			index.lessonGroups = index.languages + index.languageCount * LanguageEntrySize;
+			index.lessons = index.lessonGroups + index.lessonGroupCount * LessonGroupEntrySize;
+			reader.at(index.lessons, index.lessonCount * LessonEntrySize); // the tables are all there
+			reader.at(index.contents, 0);
+			return index;
+		}
+
+		std::wstring ReadString(const BlobReader& reader, const Index& index, const size_t field) // field holds the string's offset into the strings
+		{
+			const size_t pos = index.strings + static_cast<size_t>(reader.read(field, 4));
+			const size_t length = static_cast<size_t>(reader.read(pos, 4));
+			std::wstring str = L"";
+			Platform::DecodeUTF16(reader.at(pos + 4, length * 2), length * 2, str);
+			return str;
+		}
+
+		const unsigned char* LessonContent(const BlobReader& reader, const Index& index, const size_t lessonPos, size_t& contentSize)
+		{
+			const std::uint64_t offset = reader.read(lessonPos + 8, 8);
+			contentSize = static_cast<size_t>(reader.read(lessonPos + 16, 4));
+			if (offset > std::numeric_limits<size_t>::max() - index.contents) throw 6;
+			return reader.at(index.contents + static_cast<size_t>(offset), contentSize);
+		}
+
+		void CheckRange(const size_t first, const size_t count, const size_t total)
+		{
+			if (first > total || count > total - first) throw 6;
+		}
+	}
+
+	bool CourseArchive::Pack(const std::wstring& archivePath)
+	{
+		LangList langs{};
+		LessonCatalog::Scan(&langs);
+		std::vector<const Language*> languages{};
+		for (auto const & lang : langs) languages.push_back(lang.second.get());
+		std::sort(languages.begin(), languages.end(), [](const Language* a, const Language* b) { return a->langID < b->langID; });
+
+		BlobWriter strings{};
+		auto addString = [&strings](const std::wstring& str)
+		{
+			const size_t pos = strings.bytes.size();
+			std::vector<unsigned char> encoded{};
+			Platform::EncodeUTF16(str, encoded);
+			strings.u32(static_cast<std::uint32_t>(encoded.size() / 2));
+			strings.bytes.insert(strings.bytes.end(), encoded.begin(), encoded.end());
+			return static_cast<std::uint32_t>(pos);
+		};
+		BlobWriter contents{};
+		BlobWriter languageTable{};
+		BlobWriter lessonGroupTable{};
+		BlobWriter lessonTable{};
+		std::uint32_t lessonGroupCount = 0;
+		std::uint32_t lessonCount = 0;
+		for (const Language* language : languages)
+		{
+			languageTable.u32(addString(language->langID));
+			languageTable.u32(addString(language->name));
+			languageTable.u32(lessonGroupCount);
+			languageTable.u32(static_cast<std::uint32_t>(language->lessonGroups.size()));
+			for (auto const & lessonGroup : language->lessonGroups)
+			{
+				lessonGroupTable.u32(addString(lessonGroup.first));
+				lessonGroupTable.u32(addString(lessonGroup.second.name));
+				lessonGroupTable.u32(lessonCount);
+				lessonGroupTable.u32(static_cast<std::uint32_t>(lessonGroup.second.lessons.size()));
+				lessonGroupCount++;
+				for (auto const & lesson : lessonGroup.second.lessons)
+				{
+					std::vector<unsigned char> content{};
+					if (!Platform::ReadBytes(LessonCatalog::LessonPath(language->langID, language->name, lessonGroup.first, lessonGroup.second.name, lesson.first), content)) return false;
+					lessonTable.u32(addString(lesson.first));
+					lessonTable.u32(addString(lesson.second));
+					lessonTable.u64(contents.bytes.size());
+					lessonTable.u32(static_cast<std::uint32_t>(content.size()));
+					contents.bytes.insert(contents.bytes.end(), content.begin(), content.end());
+					lessonCount++;
+				}
+			}
+		}
+
+		const size_t stringsPos = HeaderSize + languageTable.bytes.size() + lessonGroupTable.bytes.size() + lessonTable.bytes.size();
+		BlobWriter file{};
+		file.bytes.insert(file.bytes.end(), Magic, Magic + sizeof(Magic));
+		file.u16(Version);
+		file.u16(0);
+		file.u32(static_cast<std::uint32_t>(languages.size()));
+		file.u32(lessonGroupCount);
+		file.u32(lessonCount);
+		file.u32(static_cast<std::uint32_t>(stringsPos));
+		file.u64(stringsPos + strings.bytes.size());
+		for (const BlobWriter* part : { &languageTable, &lessonGroupTable, &lessonTable, &strings, &contents }) file.bytes.insert(file.bytes.end(), part->bytes.begin(), part->bytes.end());
+		return Platform::WriteBytes(archivePath, file.bytes.data(), file.bytes.size(), Platform::WriteMode::TRUNCATE);
+	}
+
+	bool CourseArchive::Open(const std::wstring& archivePath)
+	{
+		std::lock_guard<std::mutex> lock(archiveMutex);
+		opened = false;
+		if (!archive.Open(archivePath)) return false;
+		try
+		{
+			ReadIndex(BlobReader(archive.data(), archive.size()));
+		}
+		catch (int)
+		{
+			archive.Close();
+			return false;
+		}
+		opened = true;
+		return true;
+	}
+
+	void CourseArchive::Close() noexcept
+	{
+		std::lock_guard<std::mutex> lock(archiveMutex);
+		archive.Close();
+		opened = false;
+	}
+
+	bool CourseArchive::IsOpen()
+	{
+		std::lock_guard<std::mutex> lock(archiveMutex);
+		return opened;
+	}
+
+	bool CourseArchive::LoadCatalog(LangList* langs) // the index only; no lesson is read
+	{
+		std::lock_guard<std::mutex> lock(archiveMutex);
+		if (!opened || langs == nullptr) return false;
+		try
+		{
+			const BlobReader reader(archive.data(), archive.size());
+			const Index index = ReadIndex(reader);
+			LangList loaded{};
+			for (size_t lang = 0; lang < index.languageCount; lang++)
+			{
+				const size_t langPos = index.languages + lang * LanguageEntrySize;
+				const size_t firstGroup = static_cast<size_t>(reader.read(langPos + 8, 4));
+				const size_t groupCount = static_cast<size_t>(reader.read(langPos + 12, 4));
+				CheckRange(firstGroup, groupCount, index.lessonGroupCount);
+				std::map<std::wstring, LessonGroup> lessonGroups{};
+				for (size_t group = firstGroup; group < firstGroup + groupCount; group++)
+				{
+					const size_t groupPos = index.lessonGroups + group * LessonGroupEntrySize;
+					const size_t firstLesson = static_cast<size_t>(reader.read(groupPos + 8, 4));
+					const size_t lessonCount = static_cast<size_t>(reader.read(groupPos + 12, 4));
+					CheckRange(firstLesson, lessonCount, index.lessonCount);
+					LessonGroup NewLessonGroup = {};
+					NewLessonGroup.name = ReadString(reader, index, groupPos + 4);
+					for (size_t lesson = firstLesson; lesson < firstLesson + lessonCount; lesson++)
+					{
+						const size_t lessonPos = index.lessons + lesson * LessonEntrySize;
+						size_t contentSize = 0;
+						LessonContent(reader, index, lessonPos, contentSize); // so a truncated archive is refused here, not halfway into the course
+						NewLessonGroup.lessons.emplace(ReadString(reader, index, lessonPos), ReadString(reader, index, lessonPos + 4));
+					}
+					lessonGroups.emplace(ReadString(reader, index, groupPos), NewLessonGroup);
+				}
+				const std::wstring langID = ReadString(reader, index, langPos);
+				loaded.emplace(langID, std::make_unique<Language>(ReadString(reader, index, langPos + 4), langID, lessonGroups));
+			}
+			*langs = std::move(loaded);
+			return true;
+		}
+		catch (int)
+		{
+			return false;
+		}
+	}
+
+	bool CourseArchive::ReadLesson(const std::wstring& langID, const std::wstring& lgID, const std::wstring& lessonID, std::wstring& text) // the lesson's .txt, decoded
+	{
+		std::lock_guard<std::mutex> lock(archiveMutex);
+		if (!opened) return false;
+		try
+		{
+			const BlobReader reader(archive.data(), archive.size());
+			const Index index = ReadIndex(reader);
+			for (size_t lang = 0; lang < index.languageCount; lang++)
+			{
+				const size_t langPos = index.languages + lang * LanguageEntrySize;
+				if (ReadString(reader, index, langPos) != langID) continue;
+				const size_t firstGroup = static_cast<size_t>(reader.read(langPos + 8, 4));
+				const size_t groupCount = static_cast<size_t>(reader.read(langPos + 12, 4));
+				CheckRange(firstGroup, groupCount, index.lessonGroupCount);
+				for (size_t group = firstGroup; group < firstGroup + groupCount; group++)
+				{
+					const size_t groupPos = index.lessonGroups + group * LessonGroupEntrySize;
+					if (ReadString(reader, index, groupPos) != lgID) continue;
+					const size_t firstLesson = static_cast<size_t>(reader.read(groupPos + 8, 4));
+					const size_t lessonCount = static_cast<size_t>(reader.read(groupPos + 12, 4));
+					CheckRange(firstLesson, lessonCount, index.lessonCount);
+					for (size_t lesson = firstLesson; lesson < firstLesson + lessonCount; lesson++)
+					{
+						const size_t lessonPos = index.lessons + lesson * LessonEntrySize;
+						if (ReadString(reader, index, lessonPos) != lessonID) continue;
+						size_t contentSize = 0;
+						const unsigned char* content = LessonContent(reader, index, lessonPos, contentSize);
+						Platform::DecodeUTF16(content, contentSize, text);
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+		catch (int)
+		{
+			return false;
+		}
+	}
+}
@@ -0,0 +1,65 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef COURSEARCHIVE_HPP
+#define COURSEARCHIVE_HPP
+
+// STL headers
+#include <string>
+#include <cstdint>
+#include <mutex>
+
+// Program headers
+#include "LessonCatalog.hpp"
+#include "Platform.hpp"
+
+namespace ASP
+{
+	class CourseArchive // the whole Languages/ tree in one file: an index the catalog is built from, then the lessons, read only when opened
+	{
+		// Layout, little-endian throughout:
+		//	header			"LCSA", u16 version, u16 reserved, u32 language count, u32 lesson group count, u32 lesson count,
+		//					u32 offset of the strings, u64 offset of the contents
+		//	languages		u32 langID, u32 name, u32 first lesson group, u32 lesson group count
+		//	lesson groups	u32 ID, u32 name, u32 first lesson, u32 lesson count
+		//	lessons			u32 ID, u32 title, u64 content offset, u32 content size
+		//	strings			what the langID/ID/name/title fields point to: u32 length in UTF-16 code units, then UTF-16LE
+		//	contents		each lesson's .txt, as it is on disk
+		// Table offsets are in bytes from the start of the strings or the contents, the header's from the start of the file.
+		public:
+			static const std::uint16_t Version = 1;
+			static const std::wstring FileName; // Course.lcpak, next to Languages/
+		private:
+			static std::mutex archiveMutex;
+			static Platform::MappedFile archive;
+			static bool opened;
+		public:
+			static bool Pack(const std::wstring& archivePath); // from the Languages/ directory tree
+			static bool Open(const std::wstring& archivePath = FileName);
+			static void Close(void) noexcept;
+			static bool IsOpen(void);
+			static bool LoadCatalog(LangList* langs);
+			static bool ReadLesson(const std::wstring& langID, const std::wstring& lgID, const std::wstring& lessonID, std::wstring& text);
+	};
+}
+
+#endif
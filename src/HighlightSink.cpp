@@ -0,0 +1,73 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <vector>
+
+// Project Headers
+#include "HighlightSink.hpp"
+
+namespace ASP
+{
+	void HighlightBatch::Add(const size_t beginPos, const size_t endPos, const HighlightSink::Color color)
+	{
+		if (beginPos >= endPos) return;
+		if (!this->runs.empty() && this->runs.back().endPos == beginPos && this->runs.back().color == color) this->runs.back().endPos = endPos;
+		else this->runs.push_back(HighlightSink::Run{ beginPos, endPos, color });
+	}
+
+	void HighlightBatch::Flush(HighlightSink& sink)
+	{
+		if (this->runs.empty()) return;
+		sink.BeginBatch();
+		for (const HighlightSink::Run& run : this->runs) sink.ApplyRun(run);
+		sink.EndBatch();
+		this->runs.clear();
+	}
+
+	void RecordingHighlightSink::BeginBatch()
+	{
+		if (this->inBatch) throw 0; // batches don't nest
+		this->inBatch = true;
+		this->batches++;
+	}
+
+	void RecordingHighlightSink::ApplyRun(const Run& run)
+	{
+		if (!this->inBatch) throw 1; // every run goes through a batch
+		this->runs.push_back(run);
+	}
+
+	void RecordingHighlightSink::EndBatch()
+	{
+		if (!this->inBatch) throw 2;
+		this->inBatch = false;
+	}
+
+	unsigned int RecordingHighlightSink::countBatches() const noexcept
+	{
+		return this->batches;
+	}
+
+	const std::vector<HighlightSink::Run>& RecordingHighlightSink::getRuns() const noexcept
+	{
+		return this->runs;
+	}
+}
@@ -0,0 +1,73 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef HIGHLIGHTSINK_HPP
+#define HIGHLIGHTSINK_HPP
+
+// STL headers
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint> // std::uint32_t
+
+namespace ASP
+{
+	class HighlightSink // wherever a highlighting pass's colors end up: a RichEdit control, or a recording of the calls
+	{
+		public:
+			using Color = std::uint32_t; // a COLORREF, without dragging in <windows.h>
+			struct Run
+			{
+				size_t beginPos = 0;
+				size_t endPos = 0;
+				Color color = 0;
+			};
+			virtual ~HighlightSink() = default;
+			virtual void BeginBatch(void) = 0;
+			virtual void ApplyRun(const Run& run) = 0;
+			virtual void EndBatch(void) = 0;
+	};
+
+	class HighlightBatch // collects a pass's runs, merges the touching ones of the same color, and hands them to a sink in one batch
+	{
+		private:
+			std::vector<HighlightSink::Run> runs{};
+		public:
+			void Add(const size_t beginPos, const size_t endPos, const HighlightSink::Color color);
+			void Flush(HighlightSink& sink); // the runs can be collected on one thread and flushed on another
+	};
+
+	class RecordingHighlightSink : public HighlightSink // counts what a pass would have cost the control
+	{
+		private:
+			unsigned int batches = 0;
+			bool inBatch = false;
+			std::vector<Run> runs{};
+		public:
+			void BeginBatch(void) override;
+			void ApplyRun(const Run& run) override;
+			void EndBatch(void) override;
+			unsigned int countBatches(void) const noexcept;
+			const std::vector<Run>& getRuns(void) const noexcept;
+	};
+}
+
+#endif
@@ -0,0 +1,222 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <memory> // std::make_unique
+#include <thread>
+#include <mutex>
+#include <algorithm> // std::min, std::max
+#include <iterator> // std::make_move_iterator
+
+// Windows Headers
+#define UNICODE
+#include <windows.h>
+
+// Project Headers
+#include "HighlightWorker.hpp"
+
+namespace ASP
+{
+	HighlightWorker::HighlightWorker(const HWND _target, const UINT _message) : target(_target), message(_message)
+	{
+		this->thread = std::thread(&HighlightWorker::Run, this);
+	}
+
+	HighlightWorker::~HighlightWorker()
+	{
+		this->Stop();
+	}
+
+	void HighlightWorker::Stop() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+		}
+		this->wake.notify_one();
+		if (this->thread.joinable()) this->thread.join();
+	}
+
+	void HighlightWorker::Submit(Edit edit) // UI thread; never waits on the lexer
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->latestVersion = edit.version; // the pass being lexed, if any, notices this and gives up
+			if (edit.reset) this->pending.clear(); // the whole text replaces whatever the earlier edits did to it
+			this->pending.push_back(std::move(edit));
+		}
+		this->wake.notify_one();
+	}
+
+	bool HighlightWorker::Apply(const Version currentVersion, HighlightSink& sink) // UI thread, when the posted message arrives
+	{
+		std::unique_ptr<Result> result{};
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			if (!this->finished || this->finished->version != currentVersion) return false; // a stale one stays for the lexer to take back, so its lines get lexed again
+			result = std::move(this->finished);
+		}
+		result->runs.Flush(sink);
+		return true;
+	}
+
+	void HighlightWorker::Run()
+	{
+		while (true)
+		{
+			std::vector<Edit> edits{};
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->wake.wait(lock, [this] { return this->stopping || !this->pending.empty(); });
+				if (this->stopping) return;
+				edits.swap(this->pending);
+				if (this->finished) // the text changed before the editor got to it
+				{
+					this->Damage(this->finished->beginLine, this->finished->endLine);
+					this->finished.reset();
+				}
+			}
+			for (const Edit& edit : edits) this->Patch(edit);
+			if (!this->grammar) continue;
+			std::unique_ptr<Result> result = std::make_unique<Result>();
+			if (!this->Lex(edits.back().version, *result)) continue; // cancelled by a newer edit
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->finished = std::move(result);
+			}
+			PostMessage(this->target, this->message, 0, 0);
+		}
+	}
+
+	void HighlightWorker::Damage(const size_t beginLine, const size_t endLine) noexcept
+	{
+		if (beginLine >= endLine) return;
+		if (this->damageBegin >= this->damageEnd)
+		{
+			this->damageBegin = beginLine;
+			this->damageEnd = endLine;
+			return;
+		}
+		this->damageBegin = std::min(this->damageBegin, beginLine);
+		this->damageEnd = std::max(this->damageEnd, endLine);
+	}
+
+	void HighlightWorker::Patch(const Edit& edit)
+	{
+		// Splices the edit into the copy of the text, so only what the edit replaced ever crosses over from the editor.
+		// Paragraphs end in a lone '\r', the same way the editor counts character positions.
+		const auto split = [](const std::wstring& text)
+		{
+			std::vector<std::wstring> split{};
+			size_t lineStart = 0;
+			while (true)
+			{
+				const size_t lineEnd = text.find(L'\r', lineStart);
+				split.push_back(text.substr(lineStart, lineEnd - lineStart));
+				if (lineEnd == std::wstring::npos) return split;
+				lineStart = lineEnd + 1;
+			}
+		};
+		if (edit.grammar != this->grammar) // a recompiled SYNTAX.txt damages every line
+		{
+			this->grammar = edit.grammar;
+			this->Damage(0, this->lines.size());
+		}
+		this->defaultColor = edit.defaultColor;
+		if (edit.reset)
+		{
+			this->lines = split(edit.inserted);
+			this->lineStates.assign(this->lines.size() + 1, SyntaxMatcher::NoDelim);
+			this->damageBegin = 0;
+			this->damageEnd = this->lines.size();
+			return;
+		}
+
+		// find the lines the replaced text starts and ends on
+		size_t first = 0;
+		size_t firstStart = 0;
+		while (first + 1 < this->lines.size() && firstStart + this->lines[first].length() < edit.pos) firstStart += this->lines[first++].length() + 1;
+		size_t last = first;
+		size_t lastStart = firstStart;
+		while (last + 1 < this->lines.size() && lastStart + this->lines[last].length() < edit.pos + edit.removed) lastStart += this->lines[last++].length() + 1;
+		const size_t beginCol = std::min(edit.pos - firstStart, this->lines[first].length());
+		const size_t endCol = std::min(edit.pos + edit.removed - lastStart, this->lines[last].length());
+		std::vector<std::wstring> patched = split(this->lines[first].substr(0, beginCol) + edit.inserted + this->lines[last].substr(endCol));
+
+		// lines [first, last] become the patched ones; the lines after keep the states they were lexed with, to tell when a pass can stop
+		const size_t count = patched.size();
+		const auto shift = [first, last, count](const size_t line) { return (line <= first) ? line : ((line > last) ? line + count - (last + 1 - first) : first + count); };
+		if (this->damageBegin < this->damageEnd)
+		{
+			this->damageBegin = shift(this->damageBegin);
+			this->damageEnd = shift(this->damageEnd);
+		}
+		this->lines.erase(this->lines.begin() + first, this->lines.begin() + last + 1);
+		this->lines.insert(this->lines.begin() + first, std::make_move_iterator(patched.begin()), std::make_move_iterator(patched.end()));
+		this->lineStates.erase(this->lineStates.begin() + first + 1, this->lineStates.begin() + last + 1);
+		this->lineStates.insert(this->lineStates.begin() + first + 1, count - 1, SyntaxMatcher::NoDelim);
+		this->Damage(first, first + count);
+	}
+
+	bool HighlightWorker::Lex(const Version version, Result& result)
+	{
+		// Re-lex from the first damaged line, and keep going past the last one only until a line starts in the same
+		// state it did before, so a keystroke costs the edited lines plus whatever a DELIM opened or closed by it spans.
+		const SyntaxMatcher& matcher = this->grammar->getMatcher();
+		size_t pos = 0;
+		for (size_t lineNo = 0; lineNo < this->damageBegin; lineNo++) pos += this->lines[lineNo].length() + 1;
+		std::vector<SyntaxMatcher::Token> tokens{};
+		size_t lineNo = this->damageBegin;
+		while (lineNo < this->lines.size())
+		{
+			if (this->latestVersion != version) // the states up to this line were overwritten, so the next pass can't stop before it
+			{
+				this->damageEnd = std::max(this->damageEnd, lineNo + 1);
+				return false;
+			}
+			const std::wstring& line = this->lines[lineNo];
+			tokens.clear();
+			const SyntaxMatcher::State next = matcher.MatchLine(line, this->lineStates[lineNo], tokens);
+			size_t runPos = pos;
+			COLORREF color = this->defaultColor;
+			for (const SyntaxMatcher::Token& token : tokens)
+			{
+				color = this->grammar->getPatternColor(token.pattern);
+				result.runs.Add(runPos, pos + token.beginPos, this->defaultColor);
+				result.runs.Add(pos + token.beginPos, pos + token.endPos, color);
+				runPos = pos + token.endPos;
+			}
+			if (runPos < pos + line.length()) color = this->defaultColor;
+			pos += line.length() + ((lineNo + 1 < this->lines.size()) ? 1 : 0);
+			result.runs.Add(runPos, pos, color); // the line break takes the color that ends the line, so runs carry on across lines
+			const bool settled = lineNo + 1 >= this->damageEnd && next == this->lineStates[lineNo + 1]; // the rest is highlighted already
+			this->lineStates[++lineNo] = next;
+			if (settled) break;
+		}
+		result.version = version;
+		result.beginLine = this->damageBegin;
+		result.endLine = lineNo;
+		this->damageBegin = 0;
+		this->damageEnd = 0;
+		return true;
+	}
+}
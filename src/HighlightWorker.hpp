@@ -0,0 +1,98 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef HIGHLIGHTWORKER_HPP
+#define HIGHLIGHTWORKER_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <memory> // std::shared_ptr
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// Windows Headers
+#define UNICODE
+#include <windows.h>
+
+// Program Headers
+#include "SyntaxGrammar.hpp"
+#include "HighlightSink.hpp"
+
+namespace ASP
+{
+	class HighlightWorker // keeps a lexed copy of an editor's text off the UI thread, patches it with each edit, and posts the colors of what changed back
+	{
+		public:
+			using Version = unsigned long long;
+			struct Edit // text[pos, pos + removed) was replaced with inserted
+			{
+				Version version = 0;
+				size_t pos = 0;
+				size_t removed = 0;
+				std::wstring inserted = L"";
+				bool reset = false; // inserted is the whole text
+				std::shared_ptr<const SyntaxGrammar> grammar{};
+				COLORREF defaultColor = 0;
+			};
+		private:
+			struct Result
+			{
+				Version version = 0;
+				size_t beginLine = 0; // the lines the runs cover, damaged again if the editor never applies them
+				size_t endLine = 0;
+				HighlightBatch runs{}; // in text order, flushed by the UI thread
+			};
+			HWND target = nullptr;
+			UINT message = 0;
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::vector<Edit> pending{};
+			std::unique_ptr<Result> finished{};
+			std::atomic<Version> latestVersion{ 0 };
+			bool stopping = false;
+			// only the lexer thread touches these: the text one paragraph per line, and the lexer state at the start of each line and after the last one
+			std::vector<std::wstring> lines{ L"" };
+			std::vector<SyntaxMatcher::State> lineStates{ SyntaxMatcher::NoDelim, SyntaxMatcher::NoDelim };
+			std::shared_ptr<const SyntaxGrammar> grammar{};
+			COLORREF defaultColor = 0;
+			size_t damageBegin = 0; // lines [damageBegin, damageEnd) need lexing again
+			size_t damageEnd = 0;
+			std::thread thread;
+			void Run(void);
+			void Damage(const size_t beginLine, const size_t endLine) noexcept;
+			void Patch(const Edit& edit);
+			bool Lex(const Version version, Result& result);
+		public:
+			HighlightWorker(const HWND _target, const UINT _message);
+			HighlightWorker(const HighlightWorker&) = delete;
+			HighlightWorker& operator=(const HighlightWorker&) = delete;
+			~HighlightWorker();
+			void Submit(Edit edit);
+			bool Apply(const Version currentVersion, HighlightSink& sink);
+			void Stop(void) noexcept;
+	};
+}
+
+#endif
@@ -0,0 +1,228 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstring> // std::memcmp
+#include <utility> // std::move
+
+// Project Headers
+#include "LessonBinary.hpp"
+#include "Platform.hpp"
+#include "BinaryIO.hpp"
+
+namespace ASP
+{
+	const std::wstring LessonBinary::Extension = L".lcb";
+
+	namespace
+	{
+		const char Magic[4] = { 'L', 'C', 'S', 'B' };
+		const size_t HeaderSize = 24;
+		const size_t SectionEntrySize = 12;
+
+		std::vector<unsigned char> EncodeSection(const std::vector<std::wstring_view>& lines)
+		{
+			std::vector<unsigned char> text{};
+			std::vector<std::uint32_t> lineStarts{};
+			for (size_t line = 0; line < lines.size(); line++)
+			{
+				if (line != 0) Platform::EncodeUTF16(L"\r\n", text);
+				lineStarts.push_back(static_cast<std::uint32_t>(text.size() / 2));
+				Platform::EncodeUTF16(lines[line], text);
+			}
+			BlobWriter section{};
+			section.u32(static_cast<std::uint32_t>(lineStarts.size()));
+			for (const std::uint32_t start : lineStarts) section.u32(start);
+			section.bytes.insert(section.bytes.end(), text.begin(), text.end());
+			return section.bytes;
+		}
+
+		std::vector<std::wstring_view> SplitLines(const std::wstring& text) // the way LessonParser split the text it came from
+		{
+			std::vector<std::wstring_view> lines{};
+			const std::wstring_view view = text;
+			size_t offset = 0;
+			while (true)
+			{
+				const size_t foundIndex = view.find(L"\r\n", offset);
+				lines.push_back(view.substr(offset, (foundIndex == std::wstring_view::npos) ? std::wstring_view::npos : foundIndex - offset));
+				if (foundIndex == std::wstring_view::npos) return lines;
+				offset = foundIndex + 2;
+			}
+		}
+
+		struct DecodedSection
+		{
+			std::vector<std::uint32_t> lineStarts{}; // in UTF-16 code units
+			const unsigned char* text = nullptr;
+			size_t textSize = 0; // in bytes
+		};
+
+		DecodedSection DecodeSection(const BlobReader& reader, const size_t offset, const size_t size)
+		{
+			reader.at(offset, size);
+			DecodedSection section{};
+			const size_t lineCount = static_cast<size_t>(reader.read(offset, 4));
+			if (lineCount > size / 4) throw 6;
+			const size_t textOffset = offset + 4 + lineCount * 4;
+			if (textOffset > offset + size) throw 6;
+			for (size_t line = 0; line < lineCount; line++) section.lineStarts.push_back(static_cast<std::uint32_t>(reader.read(offset + 4 + line * 4, 4)));
+			section.textSize = offset + size - textOffset;
+			section.text = reader.at(textOffset, section.textSize);
+			for (const std::uint32_t start : section.lineStarts) if (start * 2ull > section.textSize) throw 6;
+			return section;
+		}
+	}
+
+	std::wstring LessonBinary::BlobPath(const std::wstring& lessonPath)
+	{
+		const size_t dotPos = lessonPath.find_last_of(L'.');
+		const size_t separatorPos = lessonPath.find_last_of(L"\\/");
+		if (dotPos == std::wstring::npos || (separatorPos != std::wstring::npos && dotPos < separatorPos)) return lessonPath + Extension;
+		return lessonPath.substr(0, dotPos) + Extension;
+	}
+
+	bool LessonBinary::Compile(const std::wstring& lessonPath, LangList* langs)
+	{
+		try
+		{
+			LessonParser parser(lessonPath, langs);
+			parser.parse();
+			return Save(lessonPath, parser.getLessonData());
+		}
+		catch (int)
+		{
+			return false;
+		}
+	}
+
+	bool LessonBinary::Save(const std::wstring& lessonPath, const LessonParser::LessonData& data)
+	{
+		Platform::FileTime sourceTime = 0;
+		if (!Platform::GetLastWriteTime(lessonPath, sourceTime)) return false;
+
+		std::vector<std::pair<Section, std::vector<unsigned char>>> sections{};
+		sections.emplace_back(Section::TITLE, EncodeSection({ data.Title }));
+		if (data.LBox) sections.emplace_back(Section::LBOX, EncodeSection(SplitLines(data.LBoxData)));
+		if (data.SCBox)
+		{
+			sections.emplace_back(Section::SCBOX, EncodeSection(SplitLines(data.SCBoxData)));
+			sections.emplace_back(Section::SCLANG, EncodeSection({ data.SCLang }));
+			sections.emplace_back(Section::SCLANGID, EncodeSection({ data.SCLangID }));
+		}
+		if (data.BigBox) sections.emplace_back(Section::BIGBOX, EncodeSection(SplitLines(data.BigBoxData)));
+		if (data.CCButton) sections.emplace_back(Section::CCBUTTON, EncodeSection(std::vector<std::wstring_view>(data.CCButtonData.begin(), data.CCButtonData.end())));
+		std::uint32_t flags = 0;
+		if (data.LBox) flags |= HAS_LBOX;
+		if (data.SCBox) flags |= HAS_SCBOX;
+		if (data.SCReadOnly) flags |= SC_READONLY;
+		if (data.BigBox) flags |= HAS_BIGBOX;
+		if (data.CCButton) flags |= HAS_CCBUTTON;
+
+		BlobWriter blob{};
+		blob.bytes.insert(blob.bytes.end(), Magic, Magic + sizeof(Magic));
+		blob.u16(Version);
+		blob.u16(static_cast<std::uint16_t>(sections.size()));
+		blob.u64(sourceTime);
+		blob.u32(flags);
+		blob.u32(0);
+		for (auto const & section : sections)
+		{
+			blob.u16(static_cast<std::uint16_t>(section.first));
+			blob.u16(0);
+			blob.u32(0); // patched below, once the offset is known
+			blob.u32(static_cast<std::uint32_t>(section.second.size()));
+		}
+		for (size_t section = 0; section < sections.size(); section++)
+		{
+			blob.patch32(HeaderSize + section * SectionEntrySize + 4, static_cast<std::uint32_t>(blob.bytes.size()));
+			blob.bytes.insert(blob.bytes.end(), sections[section].second.begin(), sections[section].second.end());
+		}
+		return Platform::WriteBytes(BlobPath(lessonPath), blob.bytes.data(), blob.bytes.size(), Platform::WriteMode::TRUNCATE);
+	}
+
+	bool LessonBinary::Load(const std::wstring& lessonPath, LangList* langs, LessonParser::LessonData& data)
+	{
+		Platform::FileTime sourceTime = 0;
+		if (!Platform::GetLastWriteTime(lessonPath, sourceTime)) return false;
+		Platform::MappedFile file{};
+		if (!file.Open(BlobPath(lessonPath))) return false;
+		try
+		{
+			const BlobReader reader(file.data(), file.size());
+			if (std::memcmp(reader.at(0, sizeof(Magic)), Magic, sizeof(Magic)) != 0) return false;
+			if (reader.read(4, 2) != Version) return false;
+			if (reader.read(8, 8) != sourceTime) return false; // the .txt changed since it was compiled
+			const size_t sectionCount = static_cast<size_t>(reader.read(6, 2));
+			const std::uint32_t flags = static_cast<std::uint32_t>(reader.read(16, 4));
+
+			LessonParser::LessonData loaded{};
+			loaded.LBox = (flags & HAS_LBOX) != 0;
+			loaded.SCBox = (flags & HAS_SCBOX) != 0;
+			loaded.SCReadOnly = (flags & SC_READONLY) != 0;
+			loaded.BigBox = (flags & HAS_BIGBOX) != 0;
+			loaded.CCButton = (flags & HAS_CCBUTTON) != 0;
+			for (size_t entry = 0; entry < sectionCount; entry++)
+			{
+				const size_t entryPos = HeaderSize + entry * SectionEntrySize;
+				const Section id = static_cast<Section>(reader.read(entryPos, 2));
+				const DecodedSection section = DecodeSection(reader, static_cast<size_t>(reader.read(entryPos + 4, 4)), static_cast<size_t>(reader.read(entryPos + 8, 4)));
+				std::wstring* field = nullptr;
+				switch (id)
+				{
+					case Section::TITLE: field = &loaded.Title; break;
+					case Section::LBOX: field = &loaded.LBoxData; break;
+					case Section::SCBOX: field = &loaded.SCBoxData; break;
+					case Section::SCLANG: field = &loaded.SCLang; break;
+					case Section::SCLANGID: field = &loaded.SCLangID; break;
+					case Section::BIGBOX: field = &loaded.BigBoxData; break;
+					case Section::CCBUTTON: // one string per line, straight from the line table
+						for (size_t line = 0; line < section.lineStarts.size(); line++)
+						{
+							const size_t beginPos = section.lineStarts[line] * 2;
+							size_t endPos = section.textSize;
+							if (line + 1 < section.lineStarts.size())
+							{
+								if (section.lineStarts[line + 1] < section.lineStarts[line] + 2) throw 6; // each line ends in "\r\n"
+								endPos = (section.lineStarts[line + 1] - 2) * 2;
+							}
+							if (endPos < beginPos) throw 6;
+							loaded.CCButtonData.emplace_back();
+							Platform::DecodeUTF16(section.text + beginPos, endPos - beginPos, loaded.CCButtonData.back());
+						}
+						break;
+					default: break; // a section from a later version of the format
+				}
+				if (field != nullptr) Platform::DecodeUTF16(section.text, section.textSize, *field);
+			}
+			if (loaded.SCBox && langs != nullptr && langs->find(loaded.SCLangID) == langs->end()) return false; // the languages changed since it was compiled
+			data = std::move(loaded);
+			return true;
+		}
+		catch (int)
+		{
+			return false;
+		}
+	}
+}
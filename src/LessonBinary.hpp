@@ -0,0 +1,71 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef LESSONBINARY_HPP
+#define LESSONBINARY_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Program headers
+#include "LessonParser.hpp"
+#include "LessonCatalog.hpp"
+
+namespace ASP
+{
+	class LessonBinary // a lesson's LessonData compiled ahead of time, saved next to its Name_###.txt as Name_###.lcb
+	{
+		// Layout, little-endian throughout:
+		//	header			"LCSB", u16 version, u16 section count, u64 write time of the .txt, u32 flags, u32 reserved
+		//	section table	per section: u16 id, u16 reserved, u32 byte offset from the start of the blob, u32 byte size
+		//	sections		u32 line count, u32 start of each line in UTF-16 code units, then the lines as UTF-16LE joined by "\r\n"
+		public:
+			static const std::uint16_t Version = 1;
+			static const std::wstring Extension; // .lcb
+			enum class Section : std::uint16_t
+			{
+				TITLE = 1,
+				LBOX,
+				SCBOX,
+				SCLANG,
+				SCLANGID,
+				BIGBOX,
+				CCBUTTON
+			};
+			enum Flags : std::uint32_t
+			{
+				HAS_LBOX = 1 << 0,
+				HAS_SCBOX = 1 << 1,
+				SC_READONLY = 1 << 2,
+				HAS_BIGBOX = 1 << 3,
+				HAS_CCBUTTON = 1 << 4
+			};
+			static std::wstring BlobPath(const std::wstring& lessonPath);
+			static bool Compile(const std::wstring& lessonPath, LangList* langs); // parse the .txt and Save() it
+			static bool Save(const std::wstring& lessonPath, const LessonParser::LessonData& data);
+			static bool Load(const std::wstring& lessonPath, LangList* langs, LessonParser::LessonData& data); // false if there's no up to date blob to load
+	};
+}
+
+#endif
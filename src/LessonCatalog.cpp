@@ -0,0 +1,325 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <memory> // std::make_unique
+#include <algorithm> // std::find, std::min, std::max
+#include <thread>
+#include <atomic>
+
+// Project Headers
+#include "LessonCatalog.hpp"
+#include "Platform.hpp"
+#include "CourseArchive.hpp"
+
+namespace ASP
+{
+	const std::vector<std::wstring> LessonCatalog::ReservedLessonFileNames{ L"SYNTAX.txt", L"CHECKER.dll" };
+
+	namespace
+	{
+		template<class Task>
+		void RunParallel(const size_t count, const Task& task) // task(0) to task(count - 1) on a bounded pool of threads, each taking the next index until there are none left
+		{
+			const size_t workerCount = std::min<size_t>({ count, std::max(std::thread::hardware_concurrency(), 1u), size_t{ LessonCatalog::MaxScanThreads } });
+			if (workerCount <= 1)
+			{
+				for (size_t index = 0; index < count; index++) task(index);
+				return;
+			}
+			std::atomic<size_t> next{ 0 };
+			std::vector<std::thread> workers{};
+			for (size_t worker = 0; worker < workerCount; worker++)
+			{
+				workers.emplace_back([&next, &task, count]()
+				{
+					for (size_t index = next++; index < count; index = next++) task(index);
+				});
+			}
+			for (std::thread& worker : workers) worker.join();
+		}
+
+		void ReportErrors(const std::vector<std::wstring>& errors) noexcept
+		{
+			for (const std::wstring& error : errors) Platform::ReportError(error);
+		}
+	}
+
+	bool LessonCatalog::IsReservedLessonFileName(const std::wstring& filename)
+	{
+		bool isReserved = std::find(ReservedLessonFileNames.begin(), ReservedLessonFileNames.end(), filename) != ReservedLessonFileNames.end();
+		bool isDLL = false;
+		bool isCompiled = false;
+		if (filename.length() >= 4)
+		{
+			std::wstring ext = filename.substr(filename.length() - 4);
+			isDLL = ext == L".dll" || ext == L".DLL";
+			isCompiled = ext == L".lcb"; // a lesson compiled by LessonCompiler, which the .txt next to it already lists
+		}
+		return isReserved || isDLL || isCompiled;
+	}
+
+	bool LessonCatalog::IsLessonGroupDirName(const std::wstring& lg_filename)
+	{
+		return (lg_filename.length() > 4) && (lg_filename.find(L' ') != std::wstring::npos) && !IsReservedLessonFileName(lg_filename); // 4 is the length of ###_
+	}
+
+	bool LessonCatalog::IsLessonFileName(const std::wstring& filename)
+	{
+		return (filename.length() > 4) && (filename.find(L'_') != std::wstring::npos) && !IsReservedLessonFileName(filename); // 4 is the length of _###
+	}
+
+	std::wstring LessonCatalog::LessonPath(const std::wstring& langID, const std::wstring& langName, const std::wstring& lgID, const std::wstring& lgName, const std::wstring& lessonID)
+	{
+		return L"Languages/" + langID + L"_" + langName + L"/" + lgID + L" " + lgName + L"/" + langName + L"_" + lessonID + L".txt";
+	}
+
+	void LessonCatalog::Load(LangList* langs)
+	{
+		if (langs == nullptr || langs->size() != 0) return;
+		if ((CourseArchive::IsOpen() || CourseArchive::Open()) && CourseArchive::LoadCatalog(langs)) return;
+		Scan(langs);
+	}
+
+	void LessonCatalog::Scan(LangList* langs) // the directories are read in parallel, then merged in the order they were listed, as the serial walk did
+	{
+		if (langs == nullptr || langs->size() != 0) return;
+		CatalogCache cache{};
+		cache.Load(CatalogCache::FileName); // no cache is an empty one: everything is read
+
+		// get languages
+		std::vector<Platform::DirectoryEntry> entries{};
+		if (!Platform::ListDirectory(L"Languages", entries))
+		{
+			Platform::ReportError(L"Loading Languages (D1)");
+			return;
+		}
+
+		// get each language's lesson groups
+		std::vector<LanguageScan> languages(entries.size());
+		RunParallel(languages.size(), [&cache, &entries, &languages](const size_t lang)
+		{
+			LanguageScan& scan = languages[lang];
+			scan.dirName = entries[lang].name;
+			scan.writeTime = entries[lang].writeTime;
+			NameLanguage(scan);
+			scan.listed = ListLessonGroups(cache, scan);
+		});
+
+		// get every lesson group's lessons
+		std::vector<LessonGroupScan> lessonGroups{};
+		for (size_t lang = 0; lang < languages.size(); lang++)
+		{
+			for (const Platform::DirectoryEntry& lessonGroupDir : languages[lang].lessonGroupDirs) lessonGroups.push_back(LessonGroupScan{ lang, lessonGroupDir });
+		}
+		RunParallel(lessonGroups.size(), [&cache, &languages, &lessonGroups](const size_t group)
+		{
+			LessonGroupScan& scan = lessonGroups[group];
+			NameLessonGroup(scan);
+			scan.loaded = LoadLessons(cache, languages[scan.language].dirName, scan);
+		});
+
+		// what the workers ran into, in the order the serial walk reported it: each language, then its lesson groups
+		for (size_t lang = 0, group = 0; lang < languages.size(); lang++)
+		{
+			ReportErrors(languages[lang].errors);
+			for (; group < lessonGroups.size() && lessonGroups[group].language == lang; group++) ReportErrors(lessonGroups[group].errors);
+		}
+
+		// merge, and bring the cache up to date
+		CatalogCache updated{};
+		bool changed = false;
+		for (LessonGroupScan& scan : lessonGroups)
+		{
+			changed = changed || scan.changed || !scan.loaded;
+			if (!scan.loaded) continue;
+			updated.lessonGroups.emplace(CatalogCache::LessonGroupKey(languages[scan.language].dirName, scan.lessonGroupDir.name), std::move(scan.cacheEntry));
+			CheckEmplace(languages[scan.language].language.lessonGroups.emplace(scan.lgID, std::move(scan.lessonGroup)), L"LoadLanguages: LG");
+		}
+		for (LanguageScan& scan : languages)
+		{
+			changed = changed || scan.changed || !scan.listed;
+			if (!scan.listed) continue;
+			CatalogCache::LanguageDirectory& cacheEntry = updated.languages[scan.dirName];
+			cacheEntry.writeTime = scan.writeTime;
+			for (const Platform::DirectoryEntry& lessonGroupDir : scan.lessonGroupDirs) cacheEntry.lessonGroupDirs.push_back(lessonGroupDir.name);
+			std::unique_ptr<Language> NewLangPtr = std::make_unique<Language>(scan.language.name, scan.language.langID, scan.language.lessonGroups);
+			CheckEmplace(langs->emplace(scan.language.langID, std::move(NewLangPtr)), L"LoadLanguages: Lang");
+		}
+		changed = changed || updated.languages.size() != cache.languages.size() || updated.lessonGroups.size() != cache.lessonGroups.size(); // something was removed
+		if (changed) updated.Save(CatalogCache::FileName);
+	}
+
+	bool LessonCatalog::ScanLanguage(const std::wstring& dirName, Language& language)
+	{
+		LanguageScan scan{ dirName };
+		NameLanguage(scan);
+		const bool listed = ListLessonGroups(CatalogCache{}, scan);
+		ReportErrors(scan.errors);
+		if (!listed) return false;
+		for (const Platform::DirectoryEntry& lessonGroupDir : scan.lessonGroupDirs)
+		{
+			std::wstring lgID = L"";
+			LessonGroup lessonGroup{};
+			if (!ScanLessonGroup(dirName, lessonGroupDir.name, lgID, lessonGroup)) continue;
+			CheckEmplace(scan.language.lessonGroups.emplace(lgID, std::move(lessonGroup)), L"LoadLanguages: LG");
+		}
+		language = std::move(scan.language);
+		return true;
+	}
+
+	bool LessonCatalog::ScanLessonGroup(const std::wstring& dirName, const std::wstring& lg_filename, std::wstring& lgID, LessonGroup& lessonGroup)
+	{
+		LessonGroupScan scan{ 0, Platform::DirectoryEntry{ lg_filename, true } };
+		NameLessonGroup(scan);
+		const bool loaded = LoadLessons(CatalogCache{}, dirName, scan);
+		ReportErrors(scan.errors);
+		if (!loaded) return false;
+		lgID = scan.lgID;
+		lessonGroup = std::move(scan.lessonGroup);
+		return true;
+	}
+
+	void LessonCatalog::NameLanguage(LanguageScan& scan) // ###_Language
+	{
+		const size_t pos = scan.dirName.find_first_of(L"_");
+		scan.language.langID = scan.dirName.substr(0, pos);
+		scan.language.name = scan.dirName.substr(pos + 1);
+	}
+
+	void LessonCatalog::NameLessonGroup(LessonGroupScan& scan) // ### Lesson Group
+	{
+		const size_t spaceFoundPos = scan.lessonGroupDir.name.find(L' ');
+		scan.lgID = scan.lessonGroupDir.name.substr(0, spaceFoundPos);
+		scan.lessonGroup.name = scan.lessonGroupDir.name.substr(spaceFoundPos + 1);
+	}
+
+	bool LessonCatalog::ListLessonGroups(const CatalogCache& cache, LanguageScan& scan)
+	{
+		const std::wstring LanguageDirName = L"Languages/" + scan.dirName;
+		const auto cached = cache.languages.find(scan.dirName);
+		if (scan.writeTime != 0 && cached != cache.languages.end() && cached->second.writeTime == scan.writeTime) // the same lesson group directories as last time, so only their write times are needed
+		{
+			for (const std::wstring& lg_filename : cached->second.lessonGroupDirs)
+			{
+				Platform::DirectoryEntry lessonGroupDir{ lg_filename, true };
+				if (!Platform::GetLastWriteTime(LanguageDirName + L"/" + lg_filename, lessonGroupDir.writeTime)) lessonGroupDir.writeTime = 0; // re-read it
+				scan.lessonGroupDirs.push_back(lessonGroupDir);
+			}
+			return true;
+		}
+		scan.changed = true;
+		std::vector<Platform::DirectoryEntry> entries{};
+		if (!Platform::ListDirectory(LanguageDirName, entries))
+		{
+			scan.errors.push_back(L"Loading Language Groups (D1.33)");
+			return false;
+		}
+		for (const Platform::DirectoryEntry& entry : entries) // lesson groups
+		{
+			if (!IsLessonGroupDirName(entry.name)) continue;
+			scan.lessonGroupDirs.push_back(entry);
+		}
+		return true;
+	}
+
+	bool LessonCatalog::ReadTitle(const std::wstring& filePath, std::wstring& title) // the body is read when LessonPage opens the lesson, not here
+	{
+		Platform::InputFile file{};
+		if (!file.Open(filePath)) return false;
+		std::vector<unsigned char> bytes{};
+		std::wstring text = L"";
+		size_t chunkSize = TitleScanBytes;
+		bool atEnd = false;
+		while (true)
+		{
+			atEnd = file.Read(bytes, chunkSize) < chunkSize;
+			Platform::DecodeUTF16(bytes.data(), bytes.size(), text);
+			const size_t titlePos = text.find(L"TITLE ");
+			const size_t startPos = titlePos + 6; // wraps to 5 when there's no TITLE, which is what the whole-file search did
+			const size_t endPos = (startPos <= text.size()) ? text.find(L"\r\n", startPos) : std::wstring::npos;
+			if (atEnd || (titlePos != std::wstring::npos && endPos != std::wstring::npos))
+			{
+				const size_t strWidth = (endPos == std::wstring::npos) ? endPos : (endPos - startPos);
+				title = (startPos <= text.size()) ? text.substr(startPos, strWidth) : L"";
+				return true;
+			}
+			chunkSize = bytes.size(); // the title isn't in what's read so far, so read as much again
+		}
+	}
+
+	bool LessonCatalog::LoadLessons(const CatalogCache& cache, const std::wstring& dirName, LessonGroupScan& scan)
+	{
+		const std::wstring LessonGroupDirName = L"Languages/" + dirName + L"/" + scan.lessonGroupDir.name;
+		const auto cached = cache.lessonGroups.find(CatalogCache::LessonGroupKey(dirName, scan.lessonGroupDir.name));
+		std::unordered_map<std::wstring, const CatalogCache::LessonFile*> cachedLessons{}; // by file name
+		if (cached != cache.lessonGroups.end()) for (const CatalogCache::LessonFile& lessonFile : cached->second.lessons) cachedLessons.emplace(lessonFile.filename, &lessonFile);
+		std::vector<Platform::DirectoryEntry> entries{};
+		if (scan.lessonGroupDir.writeTime != 0 && cached != cache.lessonGroups.end() && cached->second.writeTime == scan.lessonGroupDir.writeTime) // the same lesson files as last time, so only their write times are needed
+		{
+			for (const CatalogCache::LessonFile& lessonFile : cached->second.lessons)
+			{
+				Platform::DirectoryEntry entry{ lessonFile.filename };
+				if (!Platform::GetLastWriteTime(LessonGroupDirName + L"/" + lessonFile.filename, entry.writeTime)) entry.writeTime = 0; // re-read it
+				entries.push_back(entry);
+			}
+		}
+		else
+		{
+			scan.changed = true;
+			if (!Platform::ListDirectory(LessonGroupDirName, entries))
+			{
+				scan.errors.push_back(L"Loading Lessons (D1.67)");
+				return false;
+			}
+		}
+		scan.cacheEntry.writeTime = scan.lessonGroupDir.writeTime;
+		for (const Platform::DirectoryEntry& entry : entries) // lessons
+		{
+			const std::wstring& filename = entry.name;
+			if (!IsLessonFileName(filename)) continue;
+			const size_t underscoreFoundPos = filename.find(L'_');
+			const std::wstring filePath = LessonGroupDirName + L"/" + filename;
+			const std::wstring lessonID = filename.substr(underscoreFoundPos + 1, 3);
+			CatalogCache::LessonFile lessonFile{ filename, entry.writeTime };
+			const auto cachedLesson = cachedLessons.find(filename);
+			if (entry.writeTime != 0 && cachedLesson != cachedLessons.end() && cachedLesson->second->titled && cachedLesson->second->writeTime == entry.writeTime)
+			{
+				lessonFile.titled = true;
+				lessonFile.title = cachedLesson->second->title;
+			}
+			else
+			{
+				scan.changed = true;
+				lessonFile.titled = ReadTitle(filePath, lessonFile.title);
+			}
+			scan.cacheEntry.lessons.push_back(lessonFile);
+			if (!lessonFile.titled)
+			{
+				scan.errors.push_back(L"Read Lesson File (D3)");
+				continue;
+			}
+			if (!scan.lessonGroup.lessons.emplace(lessonID, lessonFile.title).second) scan.errors.push_back(L"CheckEmplace: LoadLanguages: Lesson");
+		}
+		return true;
+	}
+}
@@ -0,0 +1,103 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef LESSONCATALOG_HPP
+#define LESSONCATALOG_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <memory> // std::unique_ptr
+#include <unordered_map>
+#include <map>
+#include <utility> // std::pair
+
+// Program headers
+#include "Platform.hpp"
+#include "CatalogCache.hpp"
+
+namespace ASP
+{
+	using Lesson = std::pair<std::wstring, std::wstring>; // (name, ID)
+
+	struct LessonGroup
+	{
+		std::wstring name;
+		std::map<std::wstring, std::wstring> lessons; // (ID, name)
+	};
+
+	struct Language
+	{
+		Language() noexcept : name(L""), langID(L""), lessonGroups(std::map<std::wstring, LessonGroup>()) {};
+		Language(const std::wstring& name_, const std::wstring& langID_, std::map<std::wstring, LessonGroup>& lessonGroups_) noexcept : name(name_), langID(langID_), lessonGroups(lessonGroups_) {};
+		std::wstring name;
+		std::wstring langID;
+		std::map<std::wstring, LessonGroup> lessonGroups; // (ID, LG)
+	};
+
+	using LangList = std::unordered_map<std::wstring, std::unique_ptr<Language>>;
+
+	class LessonCatalog // the Languages/ directory tree: ###_Language/### Lesson Group/Language_###.txt
+	{
+		private:
+			struct LanguageScan // one language directory, read by a Scan() worker
+			{
+				std::wstring dirName = L"";
+				Platform::FileTime writeTime = 0;
+				Language language{};
+				std::vector<Platform::DirectoryEntry> lessonGroupDirs{};
+				bool listed = false;
+				bool changed = false; // listed from disk, not from the CatalogCache
+				std::vector<std::wstring> errors{}; // reported after the workers are done, so none of them waits on a message box
+			};
+			struct LessonGroupScan // one lesson group directory, read by a Scan() worker
+			{
+				size_t language = 0; // index into the LanguageScans
+				Platform::DirectoryEntry lessonGroupDir{};
+				std::wstring lgID = L"";
+				LessonGroup lessonGroup{};
+				CatalogCache::LessonGroupDirectory cacheEntry{};
+				bool loaded = false;
+				bool changed = false; // listed or a title read from disk, not all from the CatalogCache
+				std::vector<std::wstring> errors{}; // likewise
+			};
+			static void NameLanguage(LanguageScan& scan);
+			static void NameLessonGroup(LessonGroupScan& scan);
+			static bool ListLessonGroups(const CatalogCache& cache, LanguageScan& scan);
+			static const size_t TitleScanBytes = 512; // TITLE is the first line of every shipped lesson, so this almost always finds it
+			static bool ReadTitle(const std::wstring& filePath, std::wstring& title);
+			static bool LoadLessons(const CatalogCache& cache, const std::wstring& dirName, LessonGroupScan& scan);
+		public:
+			static const size_t MaxScanThreads = 16; // Scan() uses at most this many threads, and no more than there are cores
+			static const std::vector<std::wstring> ReservedLessonFileNames; // SYNTAX.txt, CHECKER.dll
+			static bool IsReservedLessonFileName(const std::wstring& filename);
+			static std::wstring LessonPath(const std::wstring& langID, const std::wstring& langName, const std::wstring& lgID, const std::wstring& lgName, const std::wstring& lessonID);
+			static bool IsLessonGroupDirName(const std::wstring& lg_filename);
+			static bool IsLessonFileName(const std::wstring& filename);
+			static bool ScanLanguage(const std::wstring& dirName, Language& language); // one ###_Language directory, all of it read from disk
+			static bool ScanLessonGroup(const std::wstring& dirName, const std::wstring& lg_filename, std::wstring& lgID, LessonGroup& lessonGroup); // one ### Lesson Group directory, likewise
+			static void Load(LangList* langs); // from the CourseArchive if there is one, else Scan()
+			static void Scan(LangList* langs); // the Languages/ directory tree, re-reading only what changed since the CatalogCache was saved
+	};
+}
+
+#endif
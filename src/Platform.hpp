@@ -0,0 +1,120 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef PLATFORM_HPP
+#define PLATFORM_HPP
+
+// STL headers
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef> // size_t
+#include <cstdint>
+
+namespace ASP
+{
+	class Platform // the file, directory, colour and error services the engines need, so they don't call Win32 directly
+	{
+		public:
+			using Color = std::uint32_t; // laid out like a COLORREF: 0x00BBGGRR
+			static constexpr Color NoColor = 0xFFFFFFFF; // never a real color, whose high byte is always 0
+			using FileTime = std::uint64_t; // only comparable to other FileTimes
+			enum class WriteMode
+			{
+				TRUNCATE, // create the file or empty it first
+				APPEND // create the file or add to its end
+			};
+			struct DirectoryEntry
+			{
+				std::wstring name = L"";
+				bool isDirectory = false;
+				std::uint64_t size = 0;
+				FileTime writeTime = 0; // as GetLastWriteTime() gives it
+			};
+			class MappedFile // a whole file mapped read-only into memory, unmapped when it goes away
+			{
+				private:
+					const unsigned char* bytes = nullptr;
+					size_t length = 0;
+					void* mapping = nullptr; // whatever the platform needs to unmap it
+				public:
+					MappedFile() noexcept = default;
+					MappedFile(const MappedFile&) = delete;
+					MappedFile& operator=(const MappedFile&) = delete;
+					~MappedFile() noexcept;
+					bool Open(const std::wstring& path);
+					void Close(void) noexcept;
+					const unsigned char* data(void) const noexcept { return this->bytes; }
+					size_t size(void) const noexcept { return this->length; }
+			};
+			class InputFile // a file read from the front a piece at a time, for when only its beginning is wanted; closed when it goes away
+			{
+				private:
+					std::intptr_t handle = -1; // whatever the platform reads it through
+				public:
+					InputFile() noexcept = default;
+					InputFile(const InputFile&) = delete;
+					InputFile& operator=(const InputFile&) = delete;
+					~InputFile() noexcept;
+					bool Open(const std::wstring& path);
+					void Close(void) noexcept;
+					size_t Read(std::vector<unsigned char>& bytes, const size_t maxSize); // appends up to maxSize bytes, and returns how many; 0 at the end
+			};
+			class DirectoryWatcher // what changes under a directory, subdirectories included: inotify on Linux, ReadDirectoryChangesW on Windows
+			{
+				private:
+					struct State;
+					State* state = nullptr;
+				public:
+					DirectoryWatcher() noexcept = default;
+					DirectoryWatcher(const DirectoryWatcher&) = delete;
+					DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+					~DirectoryWatcher() noexcept;
+					bool Open(const std::wstring& directory);
+					void Close(void) noexcept; // not while another thread is in Wait()
+					bool Wait(std::vector<std::wstring>& paths, const int timeoutMilliseconds = -1); // appends what changed, relative to the directory with / separators, or L"" when too much did to say; false once Cancel()ed
+					void Cancel(void) noexcept; // from any thread: Wait() returns false, now and from then on
+			};
+			static constexpr Color MakeColor(const unsigned char red, const unsigned char green, const unsigned char blue) noexcept
+			{
+				return static_cast<Color>(red) | (static_cast<Color>(green) << 8) | (static_cast<Color>(blue) << 16);
+			}
+			static bool ReadBytes(const std::wstring& path, std::vector<unsigned char>& bytes, const bool createIfMissing = false); // the whole file
+			static bool ReadText(const std::wstring& path, std::wstring& text); // a whole UTF-16LE file, BOM included, as it is on disk
+			static void DecodeUTF16(const unsigned char* bytes, const size_t size, std::wstring& text); // UTF-16LE bytes to wchar_t
+			static void EncodeUTF16(const std::wstring_view text, std::vector<unsigned char>& bytes); // wchar_t to UTF-16LE bytes, appended
+			static std::wstring_view MappedText(const MappedFile& file, std::wstring& storage); // UTF-16LE in place where wchar_t is UTF-16, decoded into storage where it isn't
+			static bool WriteBytes(const std::wstring& path, const void* data, const size_t size, const WriteMode mode);
+			static bool GetLastWriteTime(const std::wstring& path, FileTime& time);
+			static bool ListDirectory(const std::wstring& directory, std::vector<DirectoryEntry>& entries); // everything but . and ..
+			static void ReportError(const std::wstring& message) noexcept; // tell the user
+			static void OpenDebugConsole(void) noexcept; // somewhere for std::wcout to go
+	};
+
+	template<class t>
+	void CheckEmplace(t pair, const std::wstring& name = L"<no name provided>") noexcept // check if an emplace worked.
+	{
+		if (!pair.second) Platform::ReportError(L"CheckEmplace: " + name);
+	}
+}
+
+#endif
@@ -0,0 +1,340 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <filesystem>
+#include <memory> // std::unique_ptr
+#include <unordered_map>
+
+// POSIX Headers
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // stat, fstat
+#include <unistd.h> // close, read, write
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <cerrno>
+
+// Project Headers
+#include "Platform.hpp"
+
+namespace ASP
+{
+	namespace
+	{
+		std::filesystem::path ToPath(const std::wstring& path) // the engines build their paths with both kinds of separator
+		{
+			std::wstring generic = path;
+			for (wchar_t& c : generic) if (c == L'\\') c = L'/';
+			return std::filesystem::path(generic);
+		}
+
+		Platform::FileTime ToFileTime(const struct stat& status) noexcept // nanoseconds since 1970
+		{
+			return static_cast<Platform::FileTime>(status.st_mtim.tv_sec) * 1000000000u + static_cast<Platform::FileTime>(status.st_mtim.tv_nsec);
+		}
+	}
+
+	bool Platform::ReadBytes(const std::wstring& path, std::vector<unsigned char>& bytes, const bool createIfMissing)
+	{
+		const std::filesystem::path filePath = ToPath(path);
+		if (createIfMissing && !std::filesystem::exists(filePath)) std::ofstream(filePath, std::ios::binary);
+		std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+		if (!file) return false;
+		const std::streamoff fileSize = file.tellg();
+		if (fileSize < 0) return false;
+		bytes.resize(static_cast<size_t>(fileSize));
+		file.seekg(0);
+		if (fileSize != 0 && !file.read(reinterpret_cast<char*>(bytes.data()), fileSize)) return false;
+		return true;
+	}
+
+	void Platform::DecodeUTF16(const unsigned char* bytes, const size_t size, std::wstring& text) // wchar_t is UTF-32 here, so surrogate pairs become one character
+	{
+		text.clear();
+		text.reserve(size / 2);
+		for (size_t pos = 0; pos + 1 < size; pos += 2)
+		{
+			const char32_t unit = bytes[pos] | (bytes[pos + 1] << 8);
+			if (unit >= 0xD800 && unit < 0xDC00 && pos + 3 < size)
+			{
+				const char32_t low = bytes[pos + 2] | (bytes[pos + 3] << 8);
+				if (low >= 0xDC00 && low < 0xE000)
+				{
+					text += static_cast<wchar_t>(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+					pos += 2;
+					continue;
+				}
+			}
+			text += static_cast<wchar_t>(unit);
+		}
+	}
+
+	void Platform::EncodeUTF16(const std::wstring_view text, std::vector<unsigned char>& bytes)
+	{
+		for (const wchar_t c : text)
+		{
+			char32_t unit = static_cast<char32_t>(c);
+			if (unit > 0xFFFF)
+			{
+				unit -= 0x10000;
+				const char32_t high = 0xD800 + (unit >> 10);
+				bytes.push_back(static_cast<unsigned char>(high & 0xFF));
+				bytes.push_back(static_cast<unsigned char>(high >> 8));
+				unit = 0xDC00 + (unit & 0x3FF);
+			}
+			bytes.push_back(static_cast<unsigned char>(unit & 0xFF));
+			bytes.push_back(static_cast<unsigned char>((unit >> 8) & 0xFF));
+		}
+	}
+
+	bool Platform::ReadText(const std::wstring& path, std::wstring& text)
+	{
+		std::vector<unsigned char> bytes{};
+		if (!ReadBytes(path, bytes)) return false;
+		DecodeUTF16(bytes.data(), bytes.size(), text);
+		return true;
+	}
+
+	std::wstring_view Platform::MappedText(const MappedFile& file, std::wstring& storage) // there's no UTF-16 wchar_t to view the file as, so this is the one copy
+	{
+		DecodeUTF16(file.data(), file.size(), storage);
+		return std::wstring_view(storage);
+	}
+
+	Platform::MappedFile::~MappedFile() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::MappedFile::Open(const std::wstring& path)
+	{
+		this->Close();
+		const int file = open(ToPath(path).c_str(), O_RDONLY | O_CLOEXEC);
+		if (file == -1) return false;
+		struct stat status = {};
+		if (fstat(file, &status) != 0)
+		{
+			close(file);
+			return false;
+		}
+		if (status.st_size == 0) // mmap won't map nothing
+		{
+			close(file);
+			return true;
+		}
+		void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		close(file); // the mapping keeps the file open
+		if (view == MAP_FAILED) return false;
+		this->bytes = static_cast<const unsigned char*>(view);
+		this->length = static_cast<size_t>(status.st_size);
+		this->mapping = view;
+		return true;
+	}
+
+	void Platform::MappedFile::Close() noexcept
+	{
+		if (this->mapping != nullptr) munmap(this->mapping, this->length);
+		this->bytes = nullptr;
+		this->length = 0;
+		this->mapping = nullptr;
+	}
+
+	Platform::InputFile::~InputFile() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::InputFile::Open(const std::wstring& path)
+	{
+		this->Close();
+		const int file = open(ToPath(path).c_str(), O_RDONLY | O_CLOEXEC);
+		if (file == -1) return false;
+		this->handle = file;
+		return true;
+	}
+
+	void Platform::InputFile::Close() noexcept
+	{
+		if (this->handle != -1) close(static_cast<int>(this->handle));
+		this->handle = -1;
+	}
+
+	size_t Platform::InputFile::Read(std::vector<unsigned char>& bytes, const size_t maxSize)
+	{
+		if (this->handle == -1 || maxSize == 0) return 0;
+		const size_t oldSize = bytes.size();
+		bytes.resize(oldSize + maxSize);
+		ssize_t bytesRead = 0;
+		do bytesRead = read(static_cast<int>(this->handle), bytes.data() + oldSize, maxSize);
+		while (bytesRead == -1 && errno == EINTR);
+		bytes.resize(oldSize + ((bytesRead > 0) ? static_cast<size_t>(bytesRead) : 0));
+		return bytes.size() - oldSize;
+	}
+
+	struct Platform::DirectoryWatcher::State
+	{
+		int notify = -1; // inotify
+		int cancel = -1; // an eventfd Cancel() signals
+		std::unordered_map<int, std::filesystem::path> watches{}; // (watch descriptor, directory relative to the watched one)
+		std::filesystem::path root{};
+		std::vector<char> buffer = std::vector<char>(64 * 1024);
+		void AddWatches(const std::filesystem::path& directory) // directory and everything under it
+		{
+			const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ONLYDIR;
+			std::error_code error{};
+			const int watch = inotify_add_watch(this->notify, (this->root / directory).c_str(), mask);
+			if (watch == -1) return;
+			this->watches[watch] = directory;
+			for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->root / directory, error))
+			{
+				if (entry.is_directory(error)) this->AddWatches(directory / entry.path().filename());
+			}
+		}
+	};
+
+	Platform::DirectoryWatcher::~DirectoryWatcher() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::DirectoryWatcher::Open(const std::wstring& directory)
+	{
+		this->Close();
+		std::unique_ptr<State> newState = std::make_unique<State>();
+		newState->root = ToPath(directory);
+		newState->notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		newState->cancel = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		this->state = newState.release();
+		if (this->state->notify == -1 || this->state->cancel == -1)
+		{
+			this->Close();
+			return false;
+		}
+		this->state->AddWatches(std::filesystem::path());
+		if (this->state->watches.empty())
+		{
+			this->Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Platform::DirectoryWatcher::Close() noexcept
+	{
+		if (this->state == nullptr) return;
+		if (this->state->notify != -1) close(this->state->notify);
+		if (this->state->cancel != -1) close(this->state->cancel);
+		delete this->state;
+		this->state = nullptr;
+	}
+
+	bool Platform::DirectoryWatcher::Wait(std::vector<std::wstring>& paths, const int timeoutMilliseconds)
+	{
+		if (this->state == nullptr) return false;
+		pollfd waitOn[2] = { { this->state->notify, POLLIN, 0 }, { this->state->cancel, POLLIN, 0 } };
+		int ready = 0;
+		do ready = poll(waitOn, 2, timeoutMilliseconds);
+		while (ready == -1 && errno == EINTR);
+		if (ready == -1 || (waitOn[1].revents & POLLIN) != 0) return false;
+		if ((waitOn[0].revents & POLLIN) == 0) return true; // timed out
+		while (true)
+		{
+			const ssize_t length = read(this->state->notify, this->state->buffer.data(), this->state->buffer.size());
+			if (length <= 0) break;
+			for (ssize_t pos = 0; pos < length;)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(this->state->buffer.data() + pos);
+				pos += sizeof(inotify_event) + event->len;
+				if ((event->mask & IN_Q_OVERFLOW) != 0)
+				{
+					paths.push_back(L""); // events were lost
+					continue;
+				}
+				const auto watch = this->state->watches.find(event->wd);
+				if (watch == this->state->watches.end()) continue;
+				if ((event->mask & IN_IGNORED) != 0) // the directory went away
+				{
+					this->state->watches.erase(watch);
+					continue;
+				}
+				if (event->len == 0) continue;
+				const std::filesystem::path path = watch->second / event->name;
+				if ((event->mask & IN_ISDIR) != 0 && (event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) this->state->AddWatches(path);
+				paths.push_back(path.generic_wstring());
+			}
+		}
+		return true;
+	}
+
+	void Platform::DirectoryWatcher::Cancel() noexcept
+	{
+		if (this->state == nullptr) return;
+		const std::uint64_t one = 1;
+		if (write(this->state->cancel, &one, sizeof(one)) == -1) return; // it's already signalled
+	}
+
+	bool Platform::WriteBytes(const std::wstring& path, const void* data, const size_t size, const WriteMode mode)
+	{
+		std::ofstream file(ToPath(path), std::ios::binary | ((mode == WriteMode::APPEND) ? std::ios::app : std::ios::trunc));
+		if (!file) return false;
+		return static_cast<bool>(file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)));
+	}
+
+	bool Platform::GetLastWriteTime(const std::wstring& path, FileTime& time)
+	{
+		struct stat status = {};
+		if (stat(ToPath(path).c_str(), &status) != 0) return false;
+		time = ToFileTime(status);
+		return true;
+	}
+
+	bool Platform::ListDirectory(const std::wstring& directory, std::vector<DirectoryEntry>& entries) // one stat per entry, for its type, size and write time together
+	{
+		entries.clear();
+		std::error_code error{};
+		std::filesystem::directory_iterator iterator(ToPath(directory), error);
+		if (error) return false;
+		for (const std::filesystem::directory_entry& entry : iterator)
+		{
+			struct stat status = {};
+			if (stat(entry.path().c_str(), &status) != 0) continue; // gone since it was listed
+			const bool isDirectory = S_ISDIR(status.st_mode);
+			entries.push_back(DirectoryEntry{ entry.path().filename().wstring(), isDirectory, isDirectory ? 0 : static_cast<std::uint64_t>(status.st_size), ToFileTime(status) });
+		}
+		return true;
+	}
+
+	void Platform::ReportError(const std::wstring& message) noexcept
+	{
+		std::wcerr << L"Error: " << message << std::endl;
+	}
+
+	void Platform::OpenDebugConsole() noexcept // stdout is already somewhere
+	{
+	}
+}
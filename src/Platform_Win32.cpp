@@ -0,0 +1,274 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdio> // freopen_s
+#include <iostream>
+
+// Windows Headers
+#define UNICODE
+#include <windows.h>
+
+// Project Headers
+#include "Platform.hpp"
+
+namespace ASP
+{
+	bool Platform::ReadBytes(const std::wstring& path, std::vector<unsigned char>& bytes, const bool createIfMissing)
+	{
+		HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, createIfMissing ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		const DWORD fileSize = GetFileSize(file, nullptr);
+		bytes.resize(fileSize);
+		DWORD bytesRead = 0;
+		const bool read = (fileSize == 0) || ReadFile(file, bytes.data(), fileSize, &bytesRead, nullptr);
+		CloseHandle(file);
+		bytes.resize(bytesRead);
+		return read;
+	}
+
+	bool Platform::ReadText(const std::wstring& path, std::wstring& text)
+	{
+		std::vector<unsigned char> bytes{};
+		if (!ReadBytes(path, bytes)) return false;
+		DecodeUTF16(bytes.data(), bytes.size(), text); // wchar_t is UTF-16 here already
+		return true;
+	}
+
+	void Platform::DecodeUTF16(const unsigned char* bytes, const size_t size, std::wstring& text)
+	{
+		text.assign(reinterpret_cast<const wchar_t*>(bytes), size / sizeof(wchar_t));
+	}
+
+	void Platform::EncodeUTF16(const std::wstring_view text, std::vector<unsigned char>& bytes)
+	{
+		const unsigned char* data = reinterpret_cast<const unsigned char*>(text.data());
+		bytes.insert(bytes.end(), data, data + text.length() * sizeof(wchar_t));
+	}
+
+	std::wstring_view Platform::MappedText(const MappedFile& file, std::wstring& storage)
+	{
+		storage.clear();
+		if (file.size() < sizeof(wchar_t)) return std::wstring_view();
+		return std::wstring_view(reinterpret_cast<const wchar_t*>(file.data()), file.size() / sizeof(wchar_t)); // the view is page aligned
+	}
+
+	Platform::MappedFile::~MappedFile() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::MappedFile::Open(const std::wstring& path)
+	{
+		this->Close();
+		HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		const DWORD fileSize = GetFileSize(file, nullptr);
+		if (fileSize == 0) // there's nothing to map, and CreateFileMapping won't map nothing
+		{
+			CloseHandle(file);
+			return true;
+		}
+		HANDLE fileMapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file); // the mapping keeps the file open
+		if (fileMapping == nullptr) return false;
+		const void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr)
+		{
+			CloseHandle(fileMapping);
+			return false;
+		}
+		this->bytes = static_cast<const unsigned char*>(view);
+		this->length = fileSize;
+		this->mapping = fileMapping;
+		return true;
+	}
+
+	void Platform::MappedFile::Close() noexcept
+	{
+		if (this->bytes != nullptr) UnmapViewOfFile(this->bytes);
+		if (this->mapping != nullptr) CloseHandle(this->mapping);
+		this->bytes = nullptr;
+		this->length = 0;
+		this->mapping = nullptr;
+	}
+
+	Platform::InputFile::~InputFile() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::InputFile::Open(const std::wstring& path)
+	{
+		this->Close();
+		HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		this->handle = reinterpret_cast<std::intptr_t>(file);
+		return true;
+	}
+
+	void Platform::InputFile::Close() noexcept
+	{
+		if (this->handle != -1) CloseHandle(reinterpret_cast<HANDLE>(this->handle));
+		this->handle = -1;
+	}
+
+	size_t Platform::InputFile::Read(std::vector<unsigned char>& bytes, const size_t maxSize)
+	{
+		if (this->handle == -1 || maxSize == 0) return 0;
+		const size_t oldSize = bytes.size();
+		bytes.resize(oldSize + maxSize);
+		DWORD bytesRead = 0;
+		if (!ReadFile(reinterpret_cast<HANDLE>(this->handle), bytes.data() + oldSize, static_cast<DWORD>(maxSize), &bytesRead, nullptr)) bytesRead = 0;
+		bytes.resize(oldSize + bytesRead);
+		return bytesRead;
+	}
+
+	struct Platform::DirectoryWatcher::State
+	{
+		HANDLE directory = INVALID_HANDLE_VALUE;
+		HANDLE cancel = nullptr; // an event Cancel() sets
+		OVERLAPPED overlapped = {};
+		std::vector<DWORD> buffer = std::vector<DWORD>(16 * 1024); // DWORD aligned, as ReadDirectoryChangesW needs
+		bool Listen(void) // until the next change
+		{
+			const DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE;
+			return ReadDirectoryChangesW(this->directory, this->buffer.data(), static_cast<DWORD>(this->buffer.size() * sizeof(DWORD)), TRUE, filter, nullptr, &this->overlapped, nullptr) != 0;
+		}
+	};
+
+	Platform::DirectoryWatcher::~DirectoryWatcher() noexcept
+	{
+		this->Close();
+	}
+
+	bool Platform::DirectoryWatcher::Open(const std::wstring& directory)
+	{
+		this->Close();
+		this->state = new State();
+		this->state->directory = CreateFile(directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		this->state->cancel = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+		this->state->overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+		if (this->state->directory == INVALID_HANDLE_VALUE || this->state->cancel == nullptr || this->state->overlapped.hEvent == nullptr || !this->state->Listen())
+		{
+			this->Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Platform::DirectoryWatcher::Close() noexcept
+	{
+		if (this->state == nullptr) return;
+		if (this->state->directory != INVALID_HANDLE_VALUE)
+		{
+			DWORD bytesReturned = 0;
+			if (CancelIoEx(this->state->directory, &this->state->overlapped)) GetOverlappedResult(this->state->directory, &this->state->overlapped, &bytesReturned, TRUE); // the buffer mustn't go while the read is pending
+			CloseHandle(this->state->directory);
+		}
+		if (this->state->cancel != nullptr) CloseHandle(this->state->cancel);
+		if (this->state->overlapped.hEvent != nullptr) CloseHandle(this->state->overlapped.hEvent);
+		delete this->state;
+		this->state = nullptr;
+	}
+
+	bool Platform::DirectoryWatcher::Wait(std::vector<std::wstring>& paths, const int timeoutMilliseconds)
+	{
+		if (this->state == nullptr) return false;
+		const HANDLE waitOn[2] = { this->state->overlapped.hEvent, this->state->cancel };
+		const DWORD waited = WaitForMultipleObjects(2, waitOn, FALSE, (timeoutMilliseconds < 0) ? INFINITE : static_cast<DWORD>(timeoutMilliseconds));
+		if (waited == WAIT_TIMEOUT) return true;
+		if (waited != WAIT_OBJECT_0) return false; // cancelled, or failed
+		DWORD bytesReturned = 0;
+		if (!GetOverlappedResult(this->state->directory, &this->state->overlapped, &bytesReturned, FALSE)) return false;
+		ResetEvent(this->state->overlapped.hEvent);
+		if (bytesReturned == 0) paths.push_back(L""); // more changed than the buffer could hold
+		const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(this->state->buffer.data());
+		for (DWORD pos = 0; bytesReturned != 0;)
+		{
+			const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(bytes + pos);
+			std::wstring path(info->FileName, info->FileNameLength / sizeof(wchar_t));
+			for (wchar_t& c : path) if (c == L'\\') c = L'/';
+			paths.push_back(path);
+			if (info->NextEntryOffset == 0) break;
+			pos += info->NextEntryOffset;
+		}
+		return this->state->Listen();
+	}
+
+	void Platform::DirectoryWatcher::Cancel() noexcept
+	{
+		if (this->state != nullptr) SetEvent(this->state->cancel);
+	}
+
+	bool Platform::WriteBytes(const std::wstring& path, const void* data, const size_t size, const WriteMode mode)
+	{
+		HANDLE file = CreateFile(path.c_str(), (mode == WriteMode::APPEND) ? FILE_APPEND_DATA : GENERIC_WRITE, 0, nullptr, (mode == WriteMode::APPEND) ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return false;
+		DWORD bytesWritten = 0;
+		const bool written = (size == 0) || (WriteFile(file, data, static_cast<DWORD>(size), &bytesWritten, nullptr) && bytesWritten == size);
+		CloseHandle(file);
+		return written;
+	}
+
+	bool Platform::GetLastWriteTime(const std::wstring& path, FileTime& time)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA attributes = {};
+		if (!GetFileAttributesEx(path.c_str(), GetFileExInfoStandard, &attributes)) return false;
+		time = (static_cast<FileTime>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+		return true;
+	}
+
+	bool Platform::ListDirectory(const std::wstring& directory, std::vector<DirectoryEntry>& entries)
+	{
+		entries.clear();
+		WIN32_FIND_DATA searchData = {};
+		const std::wstring pattern = directory + L"\\*";
+		HANDLE hFind = FindFirstFile(pattern.c_str(), &searchData);
+		if (hFind == INVALID_HANDLE_VALUE) return false;
+		do
+		{
+			const std::wstring name = searchData.cFileName;
+			if ((name == L".") || (name == L"..")) continue;
+			const bool isDirectory = (searchData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+			const FileTime writeTime = (static_cast<FileTime>(searchData.ftLastWriteTime.dwHighDateTime) << 32) | searchData.ftLastWriteTime.dwLowDateTime;
+			entries.push_back(DirectoryEntry{ name, isDirectory, (static_cast<std::uint64_t>(searchData.nFileSizeHigh) << 32) | searchData.nFileSizeLow, writeTime });
+		} while (FindNextFile(hFind, &searchData) != 0);
+		FindClose(hFind);
+		return true;
+	}
+
+	void Platform::ReportError(const std::wstring& message) noexcept
+	{
+		MessageBox(nullptr, message.c_str(), L"Error", MB_OK);
+	}
+
+	void Platform::OpenDebugConsole() noexcept
+	{
+		AllocConsole();
+		FILE * stream = nullptr;
+		if (freopen_s(&stream, "CONOUT$", "w", stdout) != 0) ReportError(L"Cannot Open Console");
+		std::ios_base::sync_with_stdio(false);
+		// do not close stream
+	}
+}
@@ -1,138 +1,236 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-// STL Headers
-#include <tuple>
-
-// Windows Headers
-#define UNICODE
-#include <windows.h>
-#include <commctrl.h>
-#include <Richedit.h>
-#pragma comment(lib, "comctl32.lib")
-#include <windowsx.h> // Edit_ functions
-
-// Program Headers
-#include "SCEdit.hpp"
-#include "WProc.hpp"
-
-namespace ASP
-{
-	SCEdit::SCEdit(WindowData& wData, const std::wstring& lang, const std::wstring& _langID, const std::wstring& defText, Metric x, Metric y, Metric width, Metric height, const HWND parent, const COLORREF _bkColor, const COLORREF textColor, const HFONT _font, const bool _readOnly) noexcept : language(lang), langID(_langID), defaultText(defText), bkColor(_bkColor), defaultTextColor(textColor), font(_font), readOnly(_readOnly)
-	{
-		this->hRichEditLibrary = LoadLibrary(L"Msftedit.dll");
-		this->handle = CreateWindowEx(0, MSFTEDIT_CLASS, defText.c_str(), ES_LEFT | ES_MULTILINE | ES_WANTRETURN | WS_VSCROLL | ES_AUTOVSCROLL | WS_HSCROLL | ES_AUTOHSCROLL | WS_VISIBLE | WS_CHILD | WS_BORDER | WS_TABSTOP, x, y, width, height, parent, nullptr, nullptr, nullptr);
-		std::unique_ptr<WindowData> wd_ptr_SCBox = std::make_unique<WindowData>(this->handle, ChildList(), _bkColor, height, width, x, y, &wData, true);
-		CheckEmplace(wData.children.emplace(L"SCBOX", std::move(wd_ptr_SCBox)), L"SCBOX");
-		SetWindowSubclass(this->handle, SCEditSubclass, 0, 0);
-		SetWindowLongPtr(this->handle, GWLP_USERDATA, (LONG_PTR)this);
-		this->applyDefaultStyles();
-	}
-
-	void SCEdit::applyDefaultStyles()
-	{
-		SendMessage(this->handle, EM_SETBKGNDCOLOR, 0, this->bkColor);
-		this->updateSyntaxHighlighting();
-		if(this->readOnly) Edit_SetReadOnly(this->handle, true);
-	}
-
-	HWND SCEdit::getHandle() const noexcept
-	{
-		return this->handle;
-	}
-
-	void SCEdit::Uninit() noexcept
-	{
-		this->handle = nullptr;
-		FreeLibrary(this->hRichEditLibrary);
-		this->hRichEditLibrary = nullptr;
-	}
-
-	void SCEdit::updateSyntaxHighlighting(const int lineNo)
-	{
-		std::wstring textToProcess = L"";
-		int startPos = 0;
-		if (lineNo < 0) // process the default text, and set the default styles
-		{
-			textToProcess = defaultText; // process the default text
-
-			LOGFONT lf = {};
-			GetObject(font, sizeof(LOGFONT), &lf);
-			CHARFORMAT format = {};
-			format.cbSize = sizeof(CHARFORMAT);
-			format.dwMask = CFM_COLOR | CFM_FACE | CFM_SIZE;
-			format.crTextColor = this->defaultTextColor;
-			wcscpy_s(format.szFaceName, LF_FACESIZE, lf.lfFaceName);
-			format.yHeight = ((lf.lfHeight * 72) / GetDeviceCaps(GetDC(nullptr), LOGPIXELSY)) * 20; // THIS FORMULA IS RIDICULOUS, @M$: convert logical units to points by multiplying by 72 then dividing by GetDeviceCaps(), convert points to twips by multiplying by 20
-			SendMessage(this->handle, EM_SETCHARFORMAT, SCF_DEFAULT, reinterpret_cast<LPARAM>(&format));
-		}
-		else // retrieve and update the specified line
-		{
-			startPos = Edit_LineIndex(this->handle, lineNo);
-			const int bufSize = Edit_LineLength(this->handle, startPos); // Documentation Error!  second param is the index of any character on the line, not the line number
-			wchar_t* buffer = new wchar_t[bufSize + 1]; // magic number
-			SecureZeroMemory(buffer, bufSize + 1);
-			const int copied = Edit_GetLine(this->handle, lineNo, reinterpret_cast<LPARAM>(buffer), bufSize); // Documentation error!  last param is number of CHARs, not buffer size
-			textToProcess = std::wstring(buffer);
-			std::cout << std::endl << '\t' << bufSize << '\t' << copied;
-			delete[] buffer;
-		}
-		SyntaxHighlighter SH(this->language, this->langID, textToProcess);
-		std::vector<SyntaxHighlighter::Instruction> instructions = SH.getInstructions();
-		size_t newLineCorrection = 0;
-		for (auto instr : instructions)
-		{
-			if (instr == SH.newLineCommand) // no need to process new line commands because we aren't writing the text
-			{
-				newLineCorrection += 1; // richedit gets confused and adds an extra character for newlines, so let's fix things
-				continue; 
-			}
-			const size_t selStartPos = startPos + std::get<0>(instr) - newLineCorrection;
-			const size_t selEndPos = startPos + std::get<1>(instr) - newLineCorrection;
-			Edit_SetSel(this->handle, selStartPos, selEndPos);
-			CHARFORMAT format = {};
-			format.cbSize = sizeof(CHARFORMAT);
-			format.dwMask = CFM_COLOR;
-			format.crTextColor = std::get<2>(instr);
-			SendMessage(this->handle, EM_SETCHARFORMAT, SCF_SELECTION, reinterpret_cast<LPARAM>(&format));
-		}
-		Edit_SetSel(this->handle, -1, 0); // deselect
-	}
-
-	void SCEdit::SHUpdate()
-	{
-		DWORD hi = 0, lo = 0;
-		SendMessage(this->handle, EM_GETSEL, (WPARAM)&hi, (LPARAM)&lo);
-		const int lineNo = Edit_LineFromChar(this->handle, -1); // retrieves the current line number; Documentation Error!  Last param must be -1, not 1
-		this->updateSyntaxHighlighting(lineNo - 1);  // since enter brings us to a new line, update the last line
-
-		// now return to default
-		const int currentCharIndex = Edit_LineIndex(this->handle, lineNo);
-		std::cout << std::endl << lineNo << std::endl << currentCharIndex << std::endl << hi << " " << lo;
-		Edit_SetSel(this->handle, currentCharIndex-1, currentCharIndex);
-		CHARFORMAT format = {};
-		format.cbSize = sizeof(CHARFORMAT);
-		format.dwMask = CFM_COLOR;
-		format.crTextColor = this->defaultTextColor;
-		SendMessage(this->handle, EM_SETCHARFORMAT, SCF_SELECTION, reinterpret_cast<LPARAM>(&format));
-		
-		Edit_SetSel(this->handle, -1, 0); // deselect
-	}
-}
\ No newline at end of file
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <memory> // std::shared_ptr
+#include <algorithm> // std::min, std::max
+
+// Windows Headers
+#define UNICODE
+#include <windows.h>
+#include <commctrl.h>
+#include <Richedit.h>
+#include <Richole.h> // IRichEditOle
+#include <tom.h> // ITextDocument
+#pragma comment(lib, "comctl32.lib")
+#include <windowsx.h> // Edit_ functions
+
+// Program Headers
+#include "SCEdit.hpp"
+#include "WProc.hpp"
+
+namespace ASP
+{
+	SCEdit::SCEdit(WindowData& wData, const std::wstring& lang, const std::wstring& _langID, const std::wstring& defText, Metric x, Metric y, Metric width, Metric height, const HWND parent, const COLORREF _bkColor, const COLORREF textColor, const HFONT _font, const bool _readOnly) noexcept : language(lang), langID(_langID), defaultText(defText), bkColor(_bkColor), defaultTextColor(textColor), font(_font), readOnly(_readOnly)
+	{
+		this->hRichEditLibrary = LoadLibrary(L"Msftedit.dll");
+		this->handle = CreateWindowEx(0, MSFTEDIT_CLASS, defText.c_str(), ES_LEFT | ES_MULTILINE | ES_WANTRETURN | WS_VSCROLL | ES_AUTOVSCROLL | WS_HSCROLL | ES_AUTOHSCROLL | WS_VISIBLE | WS_CHILD | WS_BORDER | WS_TABSTOP, x, y, width, height, parent, nullptr, nullptr, nullptr);
+		std::unique_ptr<WindowData> wd_ptr_SCBox = std::make_unique<WindowData>(this->handle, ChildList(), _bkColor, height, width, x, y, &wData, true);
+		CheckEmplace(wData.children.emplace(L"SCBOX", std::move(wd_ptr_SCBox)), L"SCBOX");
+		SetWindowSubclass(this->handle, SCEditSubclass, 0, 0);
+		SetWindowLongPtr(this->handle, GWLP_USERDATA, (LONG_PTR)this);
+		this->highlighter = std::make_unique<HighlightWorker>(this->handle, HighlightedMessage);
+		this->applyDefaultStyles();
+	}
+
+	RichEditHighlightSink::RichEditHighlightSink(const HWND _handle) noexcept : handle(_handle) {}
+
+	void RichEditHighlightSink::BeginBatch()
+	{
+		SendMessage(this->handle, EM_EXGETSEL, 0, reinterpret_cast<LPARAM>(&this->selection));
+		this->eventMask = SendMessage(this->handle, EM_SETEVENTMASK, 0, 0);
+		SendMessage(this->handle, WM_SETREDRAW, FALSE, 0);
+		IRichEditOle* richEditOle = nullptr;
+		if (SendMessage(this->handle, EM_GETOLEINTERFACE, 0, reinterpret_cast<LPARAM>(&richEditOle)) && richEditOle)
+		{
+			if (FAILED(richEditOle->QueryInterface(__uuidof(ITextDocument), reinterpret_cast<void**>(&this->textDocument)))) this->textDocument = nullptr;
+			richEditOle->Release();
+		}
+		if (this->textDocument) this->textDocument->Undo(tomSuspend, nullptr); // recoloring isn't something to undo
+	}
+
+	void RichEditHighlightSink::ApplyRun(const Run& run)
+	{
+		CHARRANGE range = { static_cast<LONG>(run.beginPos), static_cast<LONG>(run.endPos) };
+		SendMessage(this->handle, EM_EXSETSEL, 0, reinterpret_cast<LPARAM>(&range));
+		CHARFORMAT format = {};
+		format.cbSize = sizeof(CHARFORMAT);
+		format.dwMask = CFM_COLOR;
+		format.crTextColor = run.color;
+		SendMessage(this->handle, EM_SETCHARFORMAT, SCF_SELECTION, reinterpret_cast<LPARAM>(&format));
+	}
+
+	void RichEditHighlightSink::EndBatch()
+	{
+		if (this->textDocument)
+		{
+			this->textDocument->Undo(tomResume, nullptr);
+			this->textDocument->Release();
+			this->textDocument = nullptr;
+		}
+		SendMessage(this->handle, EM_EXSETSEL, 0, reinterpret_cast<LPARAM>(&this->selection));
+		SendMessage(this->handle, EM_SETEVENTMASK, 0, this->eventMask);
+		SendMessage(this->handle, WM_SETREDRAW, TRUE, 0);
+		InvalidateRect(this->handle, nullptr, false);
+	}
+
+	void SCEdit::applyDefaultStyles()
+	{
+		SendMessage(this->handle, EM_SETBKGNDCOLOR, 0, this->bkColor);
+		LOGFONT lf = {};
+		GetObject(font, sizeof(LOGFONT), &lf);
+		CHARFORMAT format = {};
+		format.cbSize = sizeof(CHARFORMAT);
+		format.dwMask = CFM_COLOR | CFM_FACE | CFM_SIZE;
+		format.crTextColor = this->defaultTextColor;
+		wcscpy_s(format.szFaceName, LF_FACESIZE, lf.lfFaceName);
+		format.yHeight = ((lf.lfHeight * 72) / GetDeviceCaps(GetDC(nullptr), LOGPIXELSY)) * 20; // THIS FORMULA IS RIDICULOUS, @M$: convert logical units to points by multiplying by 72 then dividing by GetDeviceCaps(), convert points to twips by multiplying by 20
+		SendMessage(this->handle, EM_SETCHARFORMAT, SCF_DEFAULT, reinterpret_cast<LPARAM>(&format));
+		this->updateSyntaxHighlighting();
+		if(this->readOnly) Edit_SetReadOnly(this->handle, true);
+	}
+
+	HWND SCEdit::getHandle() const noexcept
+	{
+		return this->handle;
+	}
+
+	void SCEdit::Uninit() noexcept
+	{
+		this->highlighter.reset(); // joins the thread before the window it posts to goes away
+		this->handle = nullptr;
+		FreeLibrary(this->hRichEditLibrary);
+		this->hRichEditLibrary = nullptr;
+	}
+
+	LONG SCEdit::getTextLength(const HWND handle) noexcept
+	{
+		GETTEXTLENGTHEX lengthInfo = { GTL_DEFAULT, 1200 }; // 1200 is UTF-16
+		return static_cast<LONG>(SendMessage(handle, EM_GETTEXTLENGTHEX, reinterpret_cast<WPARAM>(&lengthInfo), 0));
+	}
+
+	std::wstring SCEdit::getText() const
+	{
+		std::wstring text(getTextLength(this->handle) + 1, L'\0');
+		GETTEXTEX textInfo = {};
+		textInfo.cb = static_cast<DWORD>(text.length() * sizeof(wchar_t));
+		textInfo.flags = GT_DEFAULT; // paragraphs end in a lone '\r', the same way character positions count them
+		textInfo.codepage = 1200;
+		const LRESULT copied = SendMessage(this->handle, EM_GETTEXTEX, reinterpret_cast<WPARAM>(&textInfo), reinterpret_cast<LPARAM>(text.data()));
+		text.resize(copied);
+		return text;
+	}
+
+	std::wstring SCEdit::getTextRange(const LONG beginPos, const LONG endPos) const
+	{
+		std::wstring text(endPos - beginPos + 1, L'\0');
+		TEXTRANGE range = { { beginPos, endPos }, text.data() };
+		const LRESULT copied = SendMessage(this->handle, EM_GETTEXTRANGE, 0, reinterpret_cast<LPARAM>(&range));
+		text.resize(copied);
+		return text;
+	}
+
+	std::string SCEdit::getTextUTF8() const
+	{
+		GETTEXTLENGTHEX lengthInfo = { GTL_NUMBYTES | GTL_PRECISE | GTL_USECRLF, CP_UTF8 };
+		const LRESULT length = SendMessage(this->handle, EM_GETTEXTLENGTHEX, reinterpret_cast<WPARAM>(&lengthInfo), 0);
+		std::string text(length + 1, '\0');
+		GETTEXTEX textInfo = {};
+		textInfo.cb = static_cast<DWORD>(text.length());
+		textInfo.flags = GT_USECRLF;
+		textInfo.codepage = CP_UTF8; // the edit control converts straight to UTF-8, without a UTF-16 copy in between
+		const LRESULT copied = SendMessage(this->handle, EM_GETTEXTEX, reinterpret_cast<WPARAM>(&textInfo), reinterpret_cast<LPARAM>(text.data()));
+		text.resize(copied);
+		return text;
+	}
+
+	SCEdit::EditMark SCEdit::MarkEdit(const HWND handle) noexcept
+	{
+		EditMark mark{};
+		SendMessage(handle, EM_EXGETSEL, 0, reinterpret_cast<LPARAM>(&mark.selection));
+		mark.textLength = getTextLength(handle);
+		mark.resync = Edit_GetModify(handle) != FALSE; // every marked edit clears the flag, so something unmarked changed the text since
+		return mark;
+	}
+
+	void SCEdit::updateSyntaxHighlighting(const EditMark* const before)
+	{
+		// Hands the edit to the highlighter thread and returns right away; the colors come back through
+		// HighlightedMessage.  The thread keeps its own copy of the text, so only what the edit replaced is read back.
+		if (!this->highlighter) return;
+		try
+		{
+			this->grammar = SyntaxGrammar::Get(this->language, this->langID);
+		}
+		catch (int _errno)
+		{
+			if (!this->grammarErrorShown) // once, not on every keystroke
+			{
+				const std::wstring errStr = L"SyntaxHighlighter error: " + std::to_wstring(_errno);
+				Error(errStr.c_str());
+				this->grammarErrorShown = true;
+			}
+			if (!this->grammar) return; // otherwise keep highlighting with the last good SYNTAX.txt
+		}
+
+		HighlightWorker::Edit edit{};
+		if (before && !before->resync)
+		{
+			// Whatever was typed, pasted or undone ends at or after the caret, and whatever it replaced ended at or after
+			// the old selection's end; the text before either selection is untouched.
+			CHARRANGE selection = {};
+			SendMessage(this->handle, EM_EXGETSEL, 0, reinterpret_cast<LPARAM>(&selection));
+			const LONG length = getTextLength(this->handle);
+			const LONG delta = length - before->textLength;
+			const LONG begin = std::min(before->selection.cpMin, selection.cpMin);
+			const LONG end = std::min(std::max(before->selection.cpMax + delta, selection.cpMax), length); // a selection can run past the final paragraph mark
+			edit.pos = static_cast<size_t>(begin);
+			edit.removed = static_cast<size_t>(end - delta - begin);
+			edit.inserted = this->getTextRange(begin, end);
+		}
+		else
+		{
+			edit.reset = true;
+			edit.inserted = this->getText();
+		}
+		edit.version = ++this->textVersion;
+		edit.grammar = this->grammar;
+		edit.defaultColor = this->grammar->getDefaultColor(this->defaultTextColor);
+		this->highlighter->Submit(std::move(edit));
+		Edit_SetModify(this->handle, false);
+	}
+
+	void SCEdit::SHUpdate(const EditMark& before)
+	{
+		if (!before.resync && !Edit_GetModify(this->handle)) return; // nothing was typed, pasted or deleted since the last update
+		this->updateSyntaxHighlighting(&before);
+	}
+
+	void SCEdit::SHApply()
+	{
+		if (!this->highlighter) return;
+		const bool modified = Edit_GetModify(this->handle) != FALSE; // an unmarked edit since the last update, which the next one has to see
+		RichEditHighlightSink sink(this->handle);
+		if (!this->highlighter->Apply(this->textVersion, sink)) return; // stale: a newer edit is being lexed
+		Edit_SetModify(this->handle, modified); // recoloring isn't an edit
+	}
+}
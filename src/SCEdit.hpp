@@ -1,64 +1,104 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-#pragma once
-
-#ifndef SCEDIT_HPP
-#define SCEDIT_HPP
-
-// STL Headers
-#include <string>
-
-// Windows Headers
-#define UNICODE
-#include <windows.h>
-
-// Program heaers
-#include "misc.hpp"
-#include "SyntaxHighlighter.hpp"
-
-namespace ASP
-{
-	class SCEdit
-	{
-		private:
-			bool readOnly = false;
-			HWND handle = nullptr;
-			HMODULE hRichEditLibrary = nullptr;
-			std::wstring language = L"";
-			std::wstring langID = L"";
-			std::wstring defaultText = L"";
-			COLORREF bkColor = 0;
-			COLORREF defaultTextColor = 0;
-			HFONT font = nullptr;
-			void applyDefaultStyles(void);
-			void updateSyntaxHighlighting(const int lineNo = -1);
-		public:
-			SCEdit() noexcept = default;
-			SCEdit(WindowData& wData, const std::wstring& lang, const std::wstring& _langID, const std::wstring& defText, Metric x, Metric y, Metric width, Metric height, const HWND parent, const COLORREF bkColor, const COLORREF textColor, const HFONT font, const bool _readOnly = false) noexcept;
-			HWND getHandle(void) const noexcept;
-			//HMODULE getLibHandle(void) const noexcept;
-			void Uninit(void) noexcept;
-			void SHUpdate(void);
-			
-	};
-}
-
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef SCEDIT_HPP
+#define SCEDIT_HPP
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <memory> // std::shared_ptr
+
+// Windows Headers
+#define UNICODE
+#include <windows.h>
+#include <Richedit.h> // CHARRANGE
+
+// Program heaers
+#include "misc.hpp"
+#include "SyntaxGrammar.hpp"
+#include "HighlightSink.hpp"
+#include "HighlightWorker.hpp"
+
+struct ITextDocument;
+
+namespace ASP
+{
+	class RichEditHighlightSink : public HighlightSink // applies a batch with redraw, undo and change notifications off, then repaints once
+	{
+		private:
+			HWND handle = nullptr;
+			CHARRANGE selection = {};
+			LRESULT eventMask = 0;
+			ITextDocument* textDocument = nullptr;
+		public:
+			explicit RichEditHighlightSink(const HWND _handle) noexcept;
+			void BeginBatch(void) override;
+			void ApplyRun(const Run& run) override;
+			void EndBatch(void) override;
+	};
+
+	class SCEdit
+	{
+		private:
+			bool readOnly = false;
+			HWND handle = nullptr;
+			HMODULE hRichEditLibrary = nullptr;
+			std::wstring language = L"";
+			std::wstring langID = L"";
+			std::wstring defaultText = L"";
+			COLORREF bkColor = 0;
+			COLORREF defaultTextColor = 0;
+			HFONT font = nullptr;
+			std::shared_ptr<const SyntaxGrammar> grammar{};
+			std::unique_ptr<HighlightWorker> highlighter{};
+			HighlightWorker::Version textVersion = 0;
+			bool grammarErrorShown = false;
+			void applyDefaultStyles(void);
+			static LONG getTextLength(const HWND handle) noexcept;
+			std::wstring getText(void) const;
+			std::wstring getTextRange(const LONG beginPos, const LONG endPos) const;
+		public:
+			struct EditMark // what an edit starts from, taken before the control handles the message
+			{
+				CHARRANGE selection = {};
+				LONG textLength = 0;
+				bool resync = false; // the text changed without a mark (drag and drop, an IME, WM_SETTEXT), so the whole of it goes to the highlighter
+			};
+		private:
+			void updateSyntaxHighlighting(const EditMark* const before = nullptr);
+		public:
+			static const UINT HighlightedMessage = WM_APP; // posted by the highlighter thread when it has colors to apply
+			SCEdit() noexcept = default;
+			SCEdit(WindowData& wData, const std::wstring& lang, const std::wstring& _langID, const std::wstring& defText, Metric x, Metric y, Metric width, Metric height, const HWND parent, const COLORREF bkColor, const COLORREF textColor, const HFONT font, const bool _readOnly = false) noexcept;
+			HWND getHandle(void) const noexcept;
+			std::string getTextUTF8(void) const; // the whole text as the CHECKER.dlls take it, with \r\n line ends as GetWindowText gives them
+			//HMODULE getLibHandle(void) const noexcept;
+			void Uninit(void) noexcept;
+			static EditMark MarkEdit(const HWND handle) noexcept;
+			void SHUpdate(const EditMark& before);
+			void SHApply(void);
+			
+	};
+}
+
 #endif
\ No newline at end of file
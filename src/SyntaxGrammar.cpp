@@ -0,0 +1,148 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <tuple>
+#include <memory> // std::make_shared
+#include <mutex>
+
+// Project Headers
+#include "SyntaxGrammar.hpp"
+#include "LessonCatalog.hpp"
+#include "Platform.hpp"
+
+namespace ASP
+{
+	using namespace std::string_literals;
+
+	const std::unordered_map<std::wstring, Platform::Color> SyntaxGrammar::ColorMap{ {L"red"s, Platform::MakeColor(0xFF, 0, 0)},
+																			 {L"yellow"s, Platform::MakeColor(0xFF, 0xFF, 0)},
+																			 {L"green"s, Platform::MakeColor(0, 0xFF, 0)},
+																			 {L"cyan"s, Platform::MakeColor(0, 0xFF, 0xFF)},
+																			 {L"blue"s, Platform::MakeColor(0, 0, 0xFF)},
+																			 {L"magenta"s, Platform::MakeColor(0xFF, 0, 0xFF)},
+																			 {L"white"s, Platform::MakeColor(0xFF, 0xFF, 0xFF)} };
+
+	std::mutex SyntaxGrammar::registryMutex;
+
+	std::unordered_map<std::wstring, SyntaxGrammar::RegistryEntry> SyntaxGrammar::registry;
+
+	SyntaxGrammar::SyntaxGrammar(const std::vector<Rule>& _rules) : rules(_rules)
+	{
+		this->CompileRules();
+	}
+
+	std::shared_ptr<const SyntaxGrammar> SyntaxGrammar::Get(const std::wstring& language, const std::wstring& langID)
+	{
+		const std::wstring dirName = langID + L"_" + language;
+		const std::wstring fileName = L"Languages/" + dirName + L"/" + LessonCatalog::ReservedLessonFileNames[0];
+		Platform::FileTime lastWriteTime = 0;
+		if (!Platform::GetLastWriteTime(fileName, lastWriteTime)) throw 0;
+
+		// only a SYNTAX.txt that was changed since it was last compiled gets reread
+		std::lock_guard<std::mutex> lock(registryMutex);
+		auto found = registry.find(dirName);
+		if (found != registry.end() && found->second.lastWriteTime == lastWriteTime) return found->second.grammar;
+		std::shared_ptr<const SyntaxGrammar> grammar = std::make_shared<const SyntaxGrammar>(LoadRules(fileName));
+		registry[dirName] = RegistryEntry{ lastWriteTime, grammar };
+		return grammar;
+	}
+
+	void SyntaxGrammar::Forget(const std::wstring& dirName) noexcept
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		registry.erase(dirName);
+	}
+
+	std::vector<SyntaxGrammar::Rule> SyntaxGrammar::LoadRules(const std::wstring& fileName)
+	{
+		std::wstring dataStr = L"";
+		if (!Platform::ReadText(fileName, dataStr)) throw 0;
+		std::vector<Rule> rules{};
+		std::wistringstream iss(dataStr);
+		std::wstring line = L"";
+		const std::wstring delim = L"\t|=|\t";
+		while (std::getline(iss, line))
+		{
+			if (!line.empty() && line.at(line.length() - 1) == L'\r') line = line.substr(0, line.length() - 1);
+			const size_t delim1 = line.find(delim);
+			const size_t delim2 = line.find(delim, delim1 + 1);
+			const size_t delim3 = line.find(delim, delim2 + 1);
+			if (delim1 == std::wstring::npos || delim2 == std::wstring::npos || delim3 == std::wstring::npos) continue;
+			const std::wstring type = line.substr(0, delim1);
+			const std::wstring param1 = line.substr(delim1 + delim.length(), delim2 - (delim1 + delim.length()) );
+			const std::wstring param2 = line.substr(delim2 + delim.length(), delim3 - (delim2 + delim.length()) );
+			const std::wstring color = line.substr(delim3 + delim.length());
+			rules.push_back(Rule(type, param1, param2, color));
+		}
+		return rules;
+	}
+
+	void SyntaxGrammar::CompileRules() // build the matcher once, so highlighting is a single pass over the text
+	{
+		std::vector<SyntaxMatcher::Pattern> patterns{};
+		for (const SyntaxGrammar::Rule& rule : this->rules)
+		{
+			auto[mode, param1, param2, colorParam] = rule;
+			const auto color = ColorMap.find(colorParam);
+			if (color == ColorMap.end()) throw 2;
+			if (mode == L"KEY") patterns.push_back(SyntaxMatcher::Pattern{ SyntaxMatcher::Mode::KEY, param1, L"" });
+			else if (mode == L"DELIM") patterns.push_back(SyntaxMatcher::Pattern{ SyntaxMatcher::Mode::DELIM, param1, param2 });
+			else
+			{
+				if (mode == L"DEFAULT")
+				{
+					this->hasDefaultColor = true;
+					this->defaultColor = color->second;
+				}
+				continue;
+			}
+			this->patternColors.push_back(color->second);
+		}
+		this->matcher = SyntaxMatcher(patterns);
+	}
+
+	const SyntaxMatcher& SyntaxGrammar::getMatcher() const noexcept
+	{
+		return this->matcher;
+	}
+
+	Platform::Color SyntaxGrammar::getPatternColor(const size_t pattern) const noexcept
+	{
+		return this->patternColors[pattern];
+	}
+
+	Platform::Color SyntaxGrammar::getDefaultColor(const Platform::Color fallback) const noexcept // the DEFAULT rule's color, if there is one
+	{
+		return this->hasDefaultColor ? this->defaultColor : fallback;
+	}
+
+	void SyntaxGrammar::DebugRules() const
+	{
+		std::wcout << L"\n----------------\n";
+		std::wcout << std::hex;
+		for (auto const & elem : this->rules) std::wcout << std::get<0>(elem) << L'\t' << std::get<1>(elem) << L'\t'
+														 << std::get<2>(elem) << L'\t' << std::get<3>(elem) << L'\n';
+		std::wcout << L"----------------\n";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef SYNTAXGRAMMAR_HPP
+#define SYNTAXGRAMMAR_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <tuple>
+#include <memory> // std::shared_ptr
+#include <mutex>
+#include <unordered_map>
+
+// Program Headers
+#include "SyntaxMatcher.hpp"
+#include "Platform.hpp"
+
+namespace ASP
+{
+	class SyntaxGrammar // a language's SYNTAX.txt, parsed and compiled once and shared by every SyntaxHighlighter
+	{
+		public:
+			using Rule = std::tuple<std::wstring, std::wstring, std::wstring, std::wstring>; // {mode, param1, param2, color}
+			static const std::unordered_map<std::wstring, Platform::Color> ColorMap;
+		private:
+			struct RegistryEntry
+			{
+				Platform::FileTime lastWriteTime = 0;
+				std::shared_ptr<const SyntaxGrammar> grammar{};
+			};
+			static std::mutex registryMutex;
+			static std::unordered_map<std::wstring, RegistryEntry> registry; // (langID_language, entry)
+			std::vector<Rule> rules{};
+			SyntaxMatcher matcher{};
+			std::vector<Platform::Color> patternColors{}; // color of each of the matcher's patterns
+			bool hasDefaultColor = false;
+			Platform::Color defaultColor = 0;
+			static std::vector<Rule> LoadRules(const std::wstring& fileName);
+			void CompileRules(void);
+		public:
+			explicit SyntaxGrammar(const std::vector<Rule>& _rules);
+			static std::shared_ptr<const SyntaxGrammar> Get(const std::wstring& language, const std::wstring& langID);
+			static void Forget(const std::wstring& dirName) noexcept; // the next Get() for ###_Language rereads its SYNTAX.txt; editors keep the grammar they have
+			const SyntaxMatcher& getMatcher(void) const noexcept;
+			Platform::Color getPatternColor(const size_t pattern) const noexcept;
+			Platform::Color getDefaultColor(const Platform::Color fallback) const noexcept;
+			void DebugRules(void) const;
+	};
+}
+
+#endif
\ No newline at end of file
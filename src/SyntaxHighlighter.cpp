@@ -1,288 +1,149 @@
-//	Copyright (c) 2016-2019 Daryl Dohner
-//	
-//	Permission is hereby granted, free of charge, to any person obtaining a copy
-//	of this software and associated documentation files (the "Software"), to deal
-//	in the Software without restriction, including without limitation the rights
-//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//	copies of the Software, and to permit persons to whom the Software is
-//	furnished to do so, subject to the following conditions:
-//	
-//	The above copyright notice and this permission notice shall be included in all
-//	copies or substantial portions of the Software.
-//	
-//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-//	SOFTWARE.
-
-// STL Headers
-#include <string>
-#include <sstream>
-#include <iostream>
-#include <tuple>
-#include <algorithm> // std::sort
-
-// Windows Headers
-#define UNICODE
-#include <windows.h>
-
-// Project Headers
-#include "SyntaxHighlighter.hpp"
-#include "misc.hpp"
-#include "gui.hpp"
-
-namespace ASP
-{
-	SyntaxHighlighter::SyntaxHighlighter(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _plainText, const COLORREF defColor) noexcept : language(_language), langID(_langID), plainText(_plainText)
-	{
-		if (defColor == -1) this->defaultColor = this->colorMap.at(L"white");
-		else this->defaultColor = defColor;
-		try
-		{
-			this->LoadRules();
-			this->DebugRules();
-			this->generateHighlightingInstructions();
-		}
-		catch (int _errno)
-		{
-			const std::wstring errStr = L"SyntaxHighlighter error: " + std::to_wstring(_errno);
-			Error(errStr.c_str());
-			std::wcout << errStr << L'\n';
-		}
-	}
-
-	SyntaxHighlighter::SyntaxHighlighter(const SyntaxHighlighter& other) noexcept : plainText(other.plainText), language(other.language), defaultColor(other.defaultColor), rules(other.rules), instructions(other.instructions) {}
-
-	SyntaxHighlighter& SyntaxHighlighter::operator=(const SyntaxHighlighter& other) noexcept
-	{
-		this->plainText = other.plainText;
-		this->language = other.language;
-		this->defaultColor = other.defaultColor;
-		this->rules = other.rules;
-		this->instructions = other.instructions;
-		return *this;
-	}
-
-	bool SyntaxHighlighter::sortInstructions(Instruction lhs, Instruction rhs)
-	{
-		return std::get<0>(lhs) < std::get<0>(rhs);
-	}
-
-	void SyntaxHighlighter::LoadRules()
-	{
-		const std::wstring fileName = L"Languages/" + this->langID + L"_" +  this->language + L"/" + GUI::ReservedLessonFileNames[0];
-		HANDLE rulesFile = CreateFile(fileName.c_str(), GENERIC_READ, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
-		if (rulesFile == INVALID_HANDLE_VALUE)
-		{
-			CloseHandle(rulesFile);
-			throw 0;
-		}
-		const unsigned int FileSize = GetFileSize(rulesFile, nullptr);
-		wchar_t * buffer = new wchar_t[FileSize/sizeof(wchar_t) + 1];
-		ZeroMemory(buffer, FileSize + sizeof(wchar_t));
-		DWORD BytesRead = 0;
-		if (!ReadFile(rulesFile, buffer, FileSize, &BytesRead, nullptr)) throw 1;
-		const std::wstring dataStr = std::wstring(buffer, buffer + (FileSize/sizeof(wchar_t)));
-		delete[] buffer;
-		std::wistringstream iss(dataStr);
-		std::wstring line = L"";
-		const std::wstring delim = L"\t|=|\t";
-		while (std::getline(iss, line))
-		{
-			if (line.at(line.length() - 1) == L'\r') line = line.substr(0, line.length() - 1);
-			const size_t delim1 = line.find(delim);
-			const size_t delim2 = line.find(delim, delim1 + 1);
-			const size_t delim3 = line.find(delim, delim2 + 1);
-			if (delim1 == std::wstring::npos || delim2 == std::wstring::npos || delim3 == std::wstring::npos) continue;
-			const std::wstring type = line.substr(0, delim1);
-			const std::wstring param1 = line.substr(delim1 + delim.length(), delim2 - (delim1 + delim.length()) );
-			const std::wstring param2 = line.substr(delim2 + delim.length(), delim3 - (delim2 + delim.length()) );
-			const std::wstring color = line.substr(delim3 + delim.length());
-			try
-			{
-				this->rules.push_back(Rule(type, param1, param2, color));
-			}
-			catch (std::exception& e)
-			{
-				std::wcout << e.what();
-			}
-		}
-		CloseHandle(rulesFile);
-	}
-
-	void SyntaxHighlighter::generateHighlightingInstructions()
-	{
-		std::wstring rawText = this->plainText;
-		for (const SyntaxHighlighter::Rule& rule : this->rules)
-		{
-			auto[mode, param1, param2, colorParam] = rule;
-			if (mode == L"KEY")
-			{
-				size_t offset = 0;
-				while (offset < rawText.size() - param1.length()) // updates even when the text is removed
-				{
-					const size_t foundPos = rawText.find(param1);
-					if (foundPos == std::wstring::npos) offset = std::wstring::npos;
-					else
-					{
-						const size_t endPos = foundPos + param1.length();
-						const std::wstring test = L"" + colorParam;
-						if (this->colorMap.find(test) == this->colorMap.end())
-						{
-							MessageBox(nullptr, L"hi", L"", MB_OK);
-						}
-						const COLORREF color = this->colorMap.at(colorParam);
-						const Instruction instr{ foundPos, endPos, color, rawText.substr(foundPos, endPos - foundPos)};
-						this->instructions.push_back(instr);
-						rawText.replace(foundPos, endPos - foundPos, endPos - foundPos, '\0'); // replace the processed characters with null characters so they don't get reprocessed and the index associations are maintained
-					}
-				}
-			}
-			else if (mode == L"DELIM")
-			{
-				size_t offset = 0;
-				while (offset < rawText.size() - param1.length()) // updates even when the text is removed
-				{
-					const size_t foundPosStart = rawText.find(param1, offset);
-					if (foundPosStart == std::wstring::npos) offset = std::wstring::npos;
-					else if (  (foundPosStart > 0 && rawText.at(foundPosStart - 1) == L'\\') 
-							&& !(foundPosStart > 1 && rawText.at(foundPosStart - 2) == L'\\')) // if the character is escaped (not to be confused with a '\\' before it) skip over it
-					{
-						offset = foundPosStart + param1.length();
-					}
-					else
-					{
-						size_t foundPosEnd = rawText.find(param2, foundPosStart + param1.length());
-						while ((foundPosEnd != std::wstring::npos)
-						   &&  (foundPosEnd >= 1 && (rawText.at(foundPosEnd - 1) == L'\\'))
-						   && !(foundPosEnd >= 2 && (rawText.at(foundPosEnd - 2) == L'\\'))) // if the character is escaped (not to be confused with a '\\' before it) skip over it)
-						{
-							foundPosEnd = rawText.find(param2, foundPosEnd + param2.length());
-						}
-						if (foundPosEnd == std::wstring::npos) offset = std::wstring::npos;
-						else
-						{
-							const size_t startPos = foundPosStart + param1.length();
-							const size_t endPos = foundPosEnd;
-							if (startPos == endPos)
-							{
-								offset = endPos;
-								continue;
-							}
-							const COLORREF color = this->colorMap.at(colorParam);
-							const Instruction instr{ startPos, endPos, color, rawText.substr(startPos, endPos - startPos)};
-							this->instructions.push_back(instr);
-							rawText.replace(startPos, endPos - startPos, endPos - startPos, L'\0'); // replace the processed characters with null characters so they don't get reprocessed and the index associations are maintained
-							offset = endPos + param2.length();
-						}
-					}
-				}
-			}
-			else if (mode == L"DEFAULT")
-			{
-				this->defaultColor = this->colorMap.at(colorParam);
-			}
-		}
-		std::sort(this->instructions.begin(), this->instructions.end(), &sortInstructions);
-		this->DebugInstructions();
-		this->fillGaps();
-		this->DebugInstructions();
-		this->accountForNewLines();
-		this->DebugInstructions();
-		this->pruneEmptyInstructions();
-		this->DebugInstructions();
-	}
-
-	std::vector<SyntaxHighlighter::Instruction> SyntaxHighlighter::getInstructions() const noexcept
-	{
-		return this->instructions;
-	}
-
-	unsigned int SyntaxHighlighter::countNewLineInstructions() const noexcept
-	{
-		return this->numNewLines;
-	}
-
-	void SyntaxHighlighter::DebugRules() const
-	{
-		std::wcout << L"\n----------------\n";
-		std::wcout << std::hex;
-		for (auto const & elem : this->rules) std::wcout << std::get<0>(elem) << L'\t' << std::get<1>(elem) << L'\t'
-														 << std::get<2>(elem) << L'\t' << std::get<3>(elem) << L'\n';
-		std::wcout << L"----------------\n";
-	}
-
-	void SyntaxHighlighter::DebugInstructions() const
-	{
-		std::wcout << L"\n----------------\n";
-		for (auto const & instr : this->instructions) std::wcout << std::dec << std::get<0>(instr) << L'\t' << std::get<1>(instr)
-																 << L'\t' << std::hex << std::get<2>(instr) << L"\t|"
-																 << std::get<3>(instr) << L"|\n";
-		std::wcout << L"----------------\n";
-	}
-
-	void SyntaxHighlighter::fillGaps()
-	{
-		for(long long index = this->instructions.size() - 2; index >= 0; index--)
-		{
-			const size_t endPosFirstInstr = std::get<1>(this->instructions[index]);
-			const size_t startPosSecondInstr = std::get<0>(this->instructions[index + 1]);
-			if (endPosFirstInstr != startPosSecondInstr)
-			{
-				Instruction gapInstr{endPosFirstInstr, startPosSecondInstr, this->defaultColor, this->plainText.substr(endPosFirstInstr, startPosSecondInstr - endPosFirstInstr)};
-				this->instructions.insert(this->instructions.begin() + index + 1, gapInstr);
-			}
-		}
-		// account for possible gap before the first instr
-		const size_t firstElemStartPos = (this->instructions.size() > 0) ? std::get<0>(this->instructions[0]) : 0;
-		if (firstElemStartPos != 0)
-		{
-			Instruction instr{ 0, firstElemStartPos, this->defaultColor, this->plainText.substr(0, firstElemStartPos) };
-			this->instructions.insert(this->instructions.begin(), instr);
-		}
-		// account for possible gap after the last instr
-		const size_t lastElemEndPos = (this->instructions.size() > 0) ? std::get<1>( this->instructions[this->instructions.size() - 1] ) : this->plainText.length();
-		if (lastElemEndPos != this->plainText.length())
-		{
-			Instruction instr{ lastElemEndPos, this->plainText.length(), this->defaultColor, this->plainText.substr(lastElemEndPos) };
-			this->instructions.push_back(instr);
-		}
-	}
-
-	void SyntaxHighlighter::accountForNewLines()
-	{
-		for (unsigned int index = 0; index < this->instructions.size(); index++)
-		{
-			auto[startPos, endPos, color, text] = this->instructions[index];
-			const std::wstring newLineToken = L"\r\n";
-			const size_t foundPos = text.find(newLineToken);
-			if (text == newLineToken)
-			{
-				this->instructions[index] = newLineCommand;
-				numNewLines++;
-			}
-			else if (foundPos != std::wstring::npos)
-			{
-				const Instruction updatedInstruction{startPos, startPos + foundPos, color, text.substr(0, foundPos)};
-				size_t startPosNew = startPos + foundPos + newLineToken.length();
-				const Instruction newInstruction{ startPosNew, endPos, color, text.substr(startPosNew - startPos) };
-				this->instructions[index] = updatedInstruction;
-				this->instructions.insert(this->instructions.begin() + index + 1, newLineCommand);
-				this->instructions.insert(this->instructions.begin() + index + 2, newInstruction);
-				numNewLines++;
-			}
-		}
-	}
-
-	void SyntaxHighlighter::pruneEmptyInstructions()
-	{
-		for (long long index = this->instructions.size() - 1; index >= 0; index--)
-		{
-			auto[pos1, pos2, color, text] = this->instructions[index];
-			if (text.empty() && pos1 != std::wstring::npos) this->instructions.erase(this->instructions.begin() + index);
-		}
-	}
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <string_view>
+#include <iostream>
+#include <algorithm> // std::find
+
+// Project Headers
+#include "SyntaxHighlighter.hpp"
+#include "Platform.hpp"
+
+namespace ASP
+{
+	SyntaxHighlighter::SyntaxHighlighter(const std::wstring& _language, const std::wstring& _langID, const std::wstring& _plainText, const Platform::Color defColor) noexcept : plainText(_plainText), language(_language), langID(_langID)
+	{
+		if (defColor == Platform::NoColor) this->defaultColor = SyntaxGrammar::ColorMap.at(L"white");
+		else this->defaultColor = defColor;
+		try
+		{
+			this->grammar = SyntaxGrammar::Get(this->language, this->langID);
+			this->defaultColor = this->grammar->getDefaultColor(this->defaultColor);
+			this->palette.push_back(this->defaultColor);
+			this->generateHighlightingInstructions();
+		}
+		catch (int _errno)
+		{
+			const std::wstring errStr = L"SyntaxHighlighter error: " + std::to_wstring(_errno);
+			Platform::ReportError(errStr);
+			std::wcout << errStr << L'\n';
+		}
+	}
+
+	size_t SyntaxHighlighter::RunList::size() const noexcept
+	{
+		return this->offsets.size();
+	}
+
+	void SyntaxHighlighter::RunList::push_back(const size_t offset, const size_t length, const unsigned char paletteIndex, const bool lineBreak)
+	{
+		this->offsets.push_back(static_cast<unsigned int>(offset));
+		this->lengths.push_back(static_cast<unsigned int>(length));
+		this->paletteIndices.push_back(paletteIndex);
+		this->lineBreaks.push_back(lineBreak);
+	}
+
+	unsigned char SyntaxHighlighter::paletteIndexOf(const Platform::Color color)
+	{
+		const auto found = std::find(this->palette.begin(), this->palette.end(), color);
+		if (found != this->palette.end()) return static_cast<unsigned char>(found - this->palette.begin());
+		if (this->palette.size() > 0xFF) throw 3;
+		this->palette.push_back(color);
+		return static_cast<unsigned char>(this->palette.size() - 1);
+	}
+
+	void SyntaxHighlighter::generateHighlightingInstructions() // one pass over the tokens, appending to the run list as it goes
+	{
+		size_t pos = 0;
+		for (const SyntaxMatcher::Token& token : this->grammar->getMatcher().Match(this->plainText))
+		{
+			this->appendRuns(pos, token.beginPos, 0); // the gap before the token is in the default color
+			this->appendRuns(token.beginPos, token.endPos, this->paletteIndexOf(this->grammar->getPatternColor(token.pattern)));
+			pos = token.endPos;
+		}
+		this->appendRuns(pos, this->plainText.length(), 0);
+	}
+
+	void SyntaxHighlighter::appendRuns(size_t beginPos, const size_t endPos, const unsigned char paletteIndex) // splits at every line break and skips empty runs
+	{
+		const std::wstring_view newLineToken = L"\r\n";
+		const std::wstring_view text = std::wstring_view(this->plainText).substr(beginPos, endPos - beginPos);
+		size_t textPos = 0;
+		while (textPos < text.length())
+		{
+			size_t breakPos = text.find(newLineToken, textPos);
+			if (breakPos == std::wstring_view::npos) breakPos = text.length();
+			if (breakPos != textPos) this->runs.push_back(beginPos + textPos, breakPos - textPos, paletteIndex, false);
+			if (breakPos == text.length()) break;
+			this->runs.push_back(beginPos + breakPos, newLineToken.length(), 0, true);
+			this->numNewLines++;
+			textPos = breakPos + newLineToken.length();
+		}
+	}
+
+	const SyntaxHighlighter::RunList& SyntaxHighlighter::getRuns() const noexcept
+	{
+		return this->runs;
+	}
+
+	size_t SyntaxHighlighter::countRuns() const noexcept
+	{
+		return this->runs.size();
+	}
+
+	std::wstring_view SyntaxHighlighter::getRunText(const size_t run) const noexcept // a view into the highlighted text, not a copy
+	{
+		return std::wstring_view(this->plainText).substr(this->runs.offsets[run], this->runs.lengths[run]);
+	}
+
+	Platform::Color SyntaxHighlighter::getRunColor(const size_t run) const noexcept
+	{
+		return this->palette[this->runs.paletteIndices[run]];
+	}
+
+	bool SyntaxHighlighter::isLineBreak(const size_t run) const noexcept
+	{
+		return this->runs.lineBreaks[run];
+	}
+
+	unsigned int SyntaxHighlighter::countNewLineInstructions() const noexcept
+	{
+		return this->numNewLines;
+	}
+
+	void SyntaxHighlighter::DebugRules() const
+	{
+		if (this->grammar) this->grammar->DebugRules();
+	}
+
+	void SyntaxHighlighter::DebugInstructions() const
+	{
+		std::wcout << L"\n----------------\n";
+		for (size_t run = 0; run < this->runs.size(); run++)
+		{
+			if (this->isLineBreak(run)) std::wcout << L"(line break)\n";
+			else std::wcout << std::dec << this->runs.offsets[run] << L'\t' << this->runs.offsets[run] + this->runs.lengths[run]
+							<< L'\t' << std::hex << this->getRunColor(run) << L"\t|" << this->getRunText(run) << L"|\n";
+		}
+		std::wcout << L"----------------\n";
+	}
 }
\ No newline at end of file
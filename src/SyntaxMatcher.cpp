@@ -0,0 +1,264 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <queue>
+#include <iterator> // std::back_inserter
+#include <algorithm> // std::lower_bound, std::sort, std::merge
+
+// Project Headers
+#include "SyntaxMatcher.hpp"
+
+namespace ASP
+{
+	SyntaxMatcher::SyntaxMatcher(const std::vector<Pattern>& _patterns) : patterns(_patterns)
+	{
+		for (unsigned int index = 0; index < this->patterns.size(); index++)
+		{
+			const Pattern& pattern = this->patterns[index];
+			if (pattern.open.empty()) continue; // an empty string would match everywhere, so it never matches
+			if (pattern.mode == Mode::KEY) this->keys.add(pattern.open, index);
+			else this->delims.add(pattern.open, index);
+		}
+		this->keys.build();
+		this->delims.build();
+	}
+
+	void SyntaxMatcher::Automaton::add(const std::wstring& str, const unsigned int pattern) // goto function: a trie of the strings
+	{
+		unsigned int node = 0;
+		for (const wchar_t c : str)
+		{
+			unsigned int next = this->child(node, c);
+			if (next == 0)
+			{
+				next = static_cast<unsigned int>(this->nodes.size());
+				this->nodes.emplace_back();
+				auto& edges = this->nodes[node].edges;
+				edges.insert(std::lower_bound(edges.begin(), edges.end(), std::make_pair(c, 0u)), std::make_pair(c, next));
+			}
+			node = next;
+		}
+		this->nodes[node].terminals.push_back(pattern);
+		if (str.length() > this->maxPatternLength) this->maxPatternLength = str.length();
+	}
+
+	void SyntaxMatcher::Automaton::build() // failure and output functions, breadth-first so every node's fail target is finished first
+	{
+		std::queue<unsigned int> queue;
+		for (auto const & edge : this->nodes[0].edges) queue.push(edge.second);
+		while (!queue.empty())
+		{
+			const unsigned int node = queue.front();
+			queue.pop();
+			const Node& failNode = this->nodes[this->nodes[node].fail];
+			std::vector<unsigned int> outputs{};
+			std::merge(this->nodes[node].terminals.begin(), this->nodes[node].terminals.end(), failNode.outputs.begin(), failNode.outputs.end(), std::back_inserter(outputs));
+			this->nodes[node].outputs = outputs;
+			for (auto const & edge : this->nodes[node].edges)
+			{
+				unsigned int fail = this->nodes[node].fail;
+				while (fail != 0 && this->child(fail, edge.first) == 0) fail = this->nodes[fail].fail;
+				const unsigned int target = this->child(fail, edge.first);
+				this->nodes[edge.second].fail = (target != edge.second) ? target : 0;
+				queue.push(edge.second);
+			}
+		}
+	}
+
+	bool SyntaxMatcher::Automaton::empty() const noexcept
+	{
+		return this->maxPatternLength == 0;
+	}
+
+	unsigned int SyntaxMatcher::Automaton::child(const unsigned int node, const wchar_t c) const noexcept // 0 means no edge (the root is never a child)
+	{
+		for (auto const & edge : this->nodes[node].edges)
+		{
+			if (edge.first == c) return edge.second;
+			if (edge.first > c) break;
+		}
+		return 0;
+	}
+
+	unsigned int SyntaxMatcher::Automaton::step(unsigned int node, const wchar_t c) const noexcept
+	{
+		while (true)
+		{
+			const unsigned int next = this->child(node, c);
+			if (next != 0 || node == 0) return next;
+			node = this->nodes[node].fail;
+		}
+	}
+
+	size_t SyntaxMatcher::Automaton::findLeftmost(const std::vector<Pattern>& patterns, const std::wstring& text, const size_t from, const size_t to, const std::vector<bool>* excluded, std::vector<unsigned int>& candidates) const
+	{
+		// returns the start of the leftmost match in [from, to) and fills candidates with every pattern matching there, first rule first
+		unsigned int node = 0;
+		size_t bestStart = std::wstring::npos;
+		candidates.clear();
+		if (this->empty()) return bestStart;
+		for (size_t pos = from; pos < to; pos++)
+		{
+			node = this->step(node, text[pos]);
+			for (const unsigned int index : this->nodes[node].outputs)
+			{
+				if (excluded != nullptr && (*excluded)[index]) continue;
+				const size_t startPos = pos + 1 - patterns[index].open.length();
+				if (startPos < bestStart)
+				{
+					bestStart = startPos;
+					candidates.clear();
+				}
+				if (startPos == bestStart) candidates.push_back(index);
+			}
+			if (bestStart != std::wstring::npos && pos + 1 - bestStart >= this->maxPatternLength) break; // nothing starting at or before bestStart is left to find
+		}
+		std::sort(candidates.begin(), candidates.end());
+		return bestStart;
+	}
+
+	bool SyntaxMatcher::isEscaped(const std::wstring& text, const size_t pos) noexcept // escaped, but not to be confused with a '\\' before it
+	{
+		return (pos >= 1 && text[pos - 1] == L'\\') && !(pos >= 2 && text[pos - 2] == L'\\');
+	}
+
+	size_t SyntaxMatcher::findClose(const std::wstring& text, const Pattern& pattern, const size_t from) const noexcept
+	{
+		if (pattern.close.empty()) return from;
+		size_t closePos = text.find(pattern.close, from);
+		while (closePos != std::wstring::npos && isEscaped(text, closePos)) closePos = text.find(pattern.close, closePos + pattern.close.length());
+		return closePos;
+	}
+
+	void SyntaxMatcher::matchKeys(const std::wstring& text, size_t from, const size_t to, std::vector<Token>& tokens, std::vector<unsigned int>& keyCandidates) const // KEY tokens in text no DELIM has claimed; keyCandidates is the caller's scratch buffer
+	{
+		while (from < to)
+		{
+			const size_t startPos = this->keys.findLeftmost(this->patterns, text, from, to, nullptr, keyCandidates);
+			if (startPos == std::wstring::npos) break;
+			const size_t endPos = startPos + this->patterns[keyCandidates.front()].open.length();
+			tokens.push_back(Token{ startPos, endPos, keyCandidates.front() });
+			from = endPos;
+		}
+	}
+
+	std::vector<SyntaxMatcher::Token> SyntaxMatcher::Match(const std::wstring& text) const
+	{
+		// One sweep, left to right.  DELIMs claim the text between their opening and closing strings (leftmost DELIM
+		// wins, the first rule in SYNTAX.txt wins ties), then the KEYs tokenize whatever is left in between, strings
+		// of the DELIMs included.  A KEY never hides a DELIM's opening string, so "-->text<" still colors the text.
+		std::vector<Token> tokens{};
+		std::vector<bool> unclosed(this->patterns.size(), false); // DELIMs with no closing string left in the text
+		std::vector<unsigned int> candidates{}; // DELIMs starting at the leftmost match
+		std::vector<unsigned int> keyCandidates{}; // matchKeys refills its own, so the loop over candidates can call it
+		size_t keyPos = 0; // start of the text the KEYs haven't seen yet
+		size_t resumePos = 0;
+		size_t bannedPattern = std::wstring::npos; // a DELIM's closing string can't reopen the same DELIM...
+		size_t bannedPos = std::wstring::npos;
+		while (resumePos < text.length())
+		{
+			const size_t startPos = this->delims.findLeftmost(this->patterns, text, resumePos, text.length(), &unclosed, candidates);
+			if (startPos == std::wstring::npos) break;
+			resumePos = startPos + 1; // if no candidate holds up, move on by one character
+			for (const unsigned int index : candidates)
+			{
+				const Pattern& pattern = this->patterns[index];
+				const size_t contentPos = startPos + pattern.open.length();
+				if ((index == bannedPattern && startPos == bannedPos) || isEscaped(text, startPos)) continue;
+				const size_t closePos = this->findClose(text, pattern, contentPos);
+				if (closePos == std::wstring::npos)
+				{
+					unclosed[index] = true; // a later opening string won't find a closing string either
+					continue;
+				}
+				resumePos = closePos;
+				if (closePos != contentPos) // ...unless the DELIM was empty
+				{
+					this->matchKeys(text, keyPos, contentPos, tokens, keyCandidates);
+					tokens.push_back(Token{ contentPos, closePos, index });
+					keyPos = closePos;
+					bannedPattern = index;
+					bannedPos = closePos;
+				}
+				break;
+			}
+		}
+		this->matchKeys(text, keyPos, text.length(), tokens, keyCandidates);
+		return tokens;
+	}
+
+	SyntaxMatcher::State SyntaxMatcher::MatchLine(const std::wstring& line, const State state, std::vector<Token>& tokens) const
+	{
+		// Match() for one line at a time, so an editor can keep the State at each line start and stop re-lexing as soon as
+		// it lines up again.  A DELIM whose closing string isn't on the line stays open into the next one, wherever it ends.
+		std::vector<unsigned int> candidates{}; // DELIMs starting at the leftmost match
+		std::vector<unsigned int> keyCandidates{}; // matchKeys refills its own, so the loop over candidates can call it
+		size_t keyPos = 0;
+		size_t resumePos = 0;
+		size_t bannedPattern = std::wstring::npos;
+		size_t bannedPos = std::wstring::npos;
+		if (state != NoDelim)
+		{
+			const size_t closePos = this->findClose(line, this->patterns[state], 0);
+			if (closePos == std::wstring::npos)
+			{
+				if (!line.empty()) tokens.push_back(Token{ 0, line.length(), state });
+				return state;
+			}
+			if (closePos != 0) tokens.push_back(Token{ 0, closePos, state });
+			keyPos = resumePos = bannedPos = closePos; // the content holds at least the line break, so it was never empty
+			bannedPattern = state;
+		}
+		while (resumePos < line.length())
+		{
+			const size_t startPos = this->delims.findLeftmost(this->patterns, line, resumePos, line.length(), nullptr, candidates);
+			if (startPos == std::wstring::npos) break;
+			resumePos = startPos + 1;
+			if (isEscaped(line, startPos)) continue;
+			for (const unsigned int index : candidates)
+			{
+				if (index == bannedPattern && startPos == bannedPos) continue;
+				const size_t contentPos = startPos + this->patterns[index].open.length();
+				const size_t closePos = this->findClose(line, this->patterns[index], contentPos);
+				if (closePos == std::wstring::npos)
+				{
+					this->matchKeys(line, keyPos, contentPos, tokens, keyCandidates);
+					if (contentPos != line.length()) tokens.push_back(Token{ contentPos, line.length(), index });
+					return index;
+				}
+				resumePos = closePos;
+				if (closePos != contentPos)
+				{
+					this->matchKeys(line, keyPos, contentPos, tokens, keyCandidates);
+					tokens.push_back(Token{ contentPos, closePos, index });
+					keyPos = closePos;
+					bannedPattern = index;
+					bannedPos = closePos;
+				}
+				break;
+			}
+		}
+		this->matchKeys(line, keyPos, line.length(), tokens, keyCandidates);
+		return NoDelim;
+	}
+}
\ No newline at end of file
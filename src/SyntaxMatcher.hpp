@@ -0,0 +1,90 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+#pragma once
+
+#ifndef SYNTAXMATCHER_HPP
+#define SYNTAXMATCHER_HPP
+
+// STL headers
+#include <string>
+#include <vector>
+#include <utility> // std::pair
+
+namespace ASP
+{
+	class SyntaxMatcher // Aho-Corasick automata over the KEY strings and the DELIM opening strings
+	{
+		public:
+			enum class Mode : unsigned char
+			{
+				KEY,
+				DELIM
+			};
+			struct Pattern
+			{
+				Mode mode = Mode::KEY;
+				std::wstring open = L"";
+				std::wstring close = L""; // DELIM only
+			};
+			struct Token
+			{
+				size_t beginPos = 0;
+				size_t endPos = 0;
+				size_t pattern = 0; // index of the pattern that produced the token
+			};
+			using State = size_t; // the DELIM a line starts inside of, carried from one line to the next
+			static constexpr State NoDelim = std::wstring::npos;
+		private:
+			class Automaton // goto/fail/output functions over a subset of the patterns
+			{
+				private:
+					struct Node
+					{
+						std::vector<std::pair<wchar_t, unsigned int>> edges{}; // (char, node), sorted by char
+						unsigned int fail = 0;
+						std::vector<unsigned int> terminals{}; // patterns spelled exactly by the path to this node
+						std::vector<unsigned int> outputs{}; // terminals of this node and of its failure chain, in pattern order
+					};
+					std::vector<Node> nodes{ Node() };
+					size_t maxPatternLength = 0;
+					unsigned int child(const unsigned int node, const wchar_t c) const noexcept;
+					unsigned int step(unsigned int node, const wchar_t c) const noexcept;
+				public:
+					void add(const std::wstring& str, const unsigned int pattern);
+					void build(void);
+					bool empty(void) const noexcept;
+					size_t findLeftmost(const std::vector<Pattern>& patterns, const std::wstring& text, const size_t from, const size_t to, const std::vector<bool>* excluded, std::vector<unsigned int>& candidates) const;
+			};
+			std::vector<Pattern> patterns{};
+			Automaton keys{};
+			Automaton delims{};
+			size_t findClose(const std::wstring& text, const Pattern& pattern, const size_t from) const noexcept;
+			void matchKeys(const std::wstring& text, size_t from, const size_t to, std::vector<Token>& tokens, std::vector<unsigned int>& keyCandidates) const;
+			static bool isEscaped(const std::wstring& text, const size_t pos) noexcept;
+		public:
+			SyntaxMatcher() noexcept = default;
+			explicit SyntaxMatcher(const std::vector<Pattern>& _patterns);
+			std::vector<Token> Match(const std::wstring& text) const;
+			State MatchLine(const std::wstring& line, const State state, std::vector<Token>& tokens) const;
+	};
+}
+
+#endif
\ No newline at end of file
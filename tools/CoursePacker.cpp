@@ -0,0 +1,54 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// Packs the Languages/ directory tree into one CourseArchive (Course.lcpak by default), which the catalog then
+// loads from its index alone, and LessonPage reads lessons out of by offset.
+// Usage: learncs_pack [directory Languages is in] [archive file name]
+
+// STL Headers
+#include <string>
+#include <iostream>
+#include <filesystem>
+
+// Program Headers
+#include "../src/CourseArchive.hpp"
+#include "../src/LessonCatalog.hpp"
+
+int main(int argc, char** argv)
+{
+	using namespace ASP;
+	if (argc > 1) std::filesystem::current_path(argv[1]); // the lesson paths are relative, like the app's
+	const std::wstring archivePath = (argc > 2) ? std::filesystem::path(argv[2]).wstring() : CourseArchive::FileName;
+	if (!CourseArchive::Pack(archivePath))
+	{
+		std::wcout << L"FAILED to pack " << archivePath << std::endl;
+		return 1;
+	}
+	LangList langs{};
+	if (!CourseArchive::Open(archivePath) || !CourseArchive::LoadCatalog(&langs)) // read it back, so a bad archive never ships
+	{
+		std::wcout << L"FAILED to read back " << archivePath << std::endl;
+		return 1;
+	}
+	size_t lessons = 0;
+	for (auto const & lang : langs) for (auto const & lessonGroup : lang.second->lessonGroups) lessons += lessonGroup.second.lessons.size();
+	std::wcout << L"packed " << langs.size() << L" languages, " << lessons << L" lessons into " << archivePath << std::endl;
+	return 0;
+}
@@ -0,0 +1,78 @@
+//	Copyright (c) 2016-2019 Daryl Dohner
+//	
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//	
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//	
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+// Compiles every Languages/###_Language/### Lesson Group/Language_###.txt into the Language_###.lcb next to it,
+// which LessonPage loads instead of parsing the text, for as long as the .txt isn't changed.
+// Usage: learncs_lessonc [directory Languages is in]
+
+// STL Headers
+#include <string>
+#include <vector>
+#include <iostream>
+#include <filesystem>
+
+// Program Headers
+#include "../src/LessonCatalog.hpp"
+#include "../src/LessonBinary.hpp"
+#include "../src/Platform.hpp"
+
+int main(int argc, char** argv)
+{
+	using namespace ASP;
+	if (argc > 1) std::filesystem::current_path(argv[1]); // the lesson paths are relative, like the app's
+	LangList langs{};
+	LessonCatalog::Load(&langs); // to resolve each SCBOX language to its langID
+	size_t compiled = 0;
+	size_t failed = 0;
+	std::vector<Platform::DirectoryEntry> languages{};
+	std::vector<Platform::DirectoryEntry> lessonGroups{};
+	std::vector<Platform::DirectoryEntry> lessons{};
+	Platform::ListDirectory(L"Languages", languages);
+	for (const Platform::DirectoryEntry& language : languages)
+	{
+		if (!language.isDirectory) continue;
+		const std::wstring languageDir = L"Languages/" + language.name;
+		Platform::ListDirectory(languageDir, lessonGroups);
+		for (const Platform::DirectoryEntry& lessonGroup : lessonGroups)
+		{
+			if (!lessonGroup.isDirectory || LessonCatalog::IsReservedLessonFileName(lessonGroup.name)) continue;
+			const std::wstring lessonGroupDir = languageDir + L"/" + lessonGroup.name;
+			Platform::ListDirectory(lessonGroupDir, lessons);
+			for (const Platform::DirectoryEntry& lesson : lessons)
+			{
+				const std::wstring& filename = lesson.name;
+				if (lesson.isDirectory || LessonCatalog::IsReservedLessonFileName(filename) || filename.length() <= 4 || filename.substr(filename.length() - 4) != L".txt") continue;
+				const std::wstring lessonPath = lessonGroupDir + L"/" + filename;
+				if (LessonBinary::Compile(lessonPath, &langs))
+				{
+					std::wcout << L"compiled " << lessonPath << L'\n';
+					compiled++;
+				}
+				else
+				{
+					std::wcout << L"FAILED   " << lessonPath << L'\n';
+					failed++;
+				}
+			}
+		}
+	}
+	std::wcout << compiled << L" compiled, " << failed << L" failed" << std::endl;
+	return (failed == 0) ? 0 : 1;
+}